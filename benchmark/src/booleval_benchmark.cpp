@@ -27,9 +27,51 @@
  *
  */
 
+#include <new>
+#include <atomic>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <numeric>
+#include <string_view>
 #include <benchmark/benchmark.h>
 #include <booleval/evaluator.hpp>
 
+namespace
+{
+    std::atomic< std::size_t > allocations{ 0 };
+
+} // namespace
+
+void * operator new( std::size_t const size )
+{
+    allocations.fetch_add( 1, std::memory_order_relaxed );
+
+    if ( auto * ptr{ std::malloc( size ) }; ptr != nullptr ) { return ptr; }
+
+    throw std::bad_alloc{};
+}
+
+// GCC does not see that the replaced operator new allocates with std::malloc
+#if defined( __GNUC__ ) && !defined( __clang__ )
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void operator delete( void * ptr ) noexcept
+{
+    std::free( ptr );
+}
+
+void operator delete( void * ptr, std::size_t ) noexcept
+{
+    std::free( ptr );
+}
+
+#if defined( __GNUC__ ) && !defined( __clang__ )
+#pragma GCC diagnostic pop
+#endif
+
 namespace
 {
 
@@ -53,6 +95,26 @@ namespace
         U value_2_{};
     };
 
+    class baz
+    {
+    public:
+        baz( std::string value_1, std::string value_2, unsigned value_3 )
+        : value_1_{ std::move( value_1 ) }
+        , value_2_{ std::move( value_2 ) }
+        , value_3_{ value_3 }
+        {}
+
+        std::string const & value_1() const noexcept { return value_1_; }
+        std::string_view    value_2() const noexcept { return value_2_; }
+        char const *        value_3() const noexcept { return std::data( value_2_ ); }
+        unsigned            value_4() const noexcept { return value_3_; }
+
+    private:
+        std::string value_1_{};
+        std::string value_2_{};
+        unsigned    value_3_{};
+    };
+
 } // namespace
 
 void BuildingExpressionTree( benchmark::State & state )
@@ -98,4 +160,119 @@ void Evaluation( benchmark::State & state )
 
 BENCHMARK( Evaluation );
 
+namespace
+{
+
+    class order
+    {
+    public:
+        explicit order( unsigned const lines ) : prices_( lines, 1.5 ) {}
+
+        // computed property, considerably more expensive than the comparison itself
+        double total() const noexcept
+        {
+            return std::accumulate( std::cbegin( prices_ ), std::cend( prices_ ), 0.0 );
+        }
+
+        unsigned lines() const noexcept { return static_cast< unsigned >( std::size( prices_ ) ); }
+
+    private:
+        std::vector< double > prices_{};
+    };
+
+} // namespace
+
+// field_1 is tested three times, but its value is fetched only once per evaluation
+void EvaluationWithComputedField( benchmark::State & state )
+{
+    booleval::typed_evaluator< order > evaluator
+    {
+        { "field_1", &order::total },
+        { "field_2", &order::lines }
+    };
+
+    order x{ 256u };
+
+    [[ maybe_unused ]] auto const success{ evaluator.expression( "(field_1 gt 1000 and field_2 1) or (field_1 lt 50 and field_2 2) or field_1 384" ) };
+
+    for ( auto _ : state )
+    {
+        [[ maybe_unused ]] auto const result{ evaluator.evaluate( x ) };
+        benchmark::DoNotOptimize( result );
+        benchmark::DoNotOptimize( x      );
+    }
+}
+
+BENCHMARK( EvaluationWithComputedField );
+
+namespace
+{
+
+    template< typename Evaluator >
+    void evaluation_without_allocations( benchmark::State & state, Evaluator & evaluator )
+    {
+        // long strings so that any copy would not fit into the small string buffer
+        baz x{ std::string( 64, 'a' ), std::string( 64, 'b' ), 1 };
+
+        [[ maybe_unused ]] auto const success
+        {
+            evaluator.expression
+            (
+                "(field_1 foo and field_4 1) or (field_2 qux and field_4 2) or field_3 bar or field_4 neq 1"
+            )
+        };
+
+        auto const before{ allocations.load() };
+
+        for ( auto _ : state )
+        {
+            [[ maybe_unused ]] auto const result{ evaluator.evaluate( x ) };
+            benchmark::DoNotOptimize( result );
+            benchmark::DoNotOptimize( x      );
+        }
+
+        auto const count{ allocations.load() - before };
+
+        state.counters[ "allocations" ] = benchmark::Counter( static_cast< double >( count ), benchmark::Counter::kAvgIterations );
+
+        if ( count != 0u )
+        {
+            state.SkipWithError( "Steady-state evaluation allocates memory" );
+        }
+    }
+
+} // namespace
+
+void EvaluationWithoutAllocations( benchmark::State & state )
+{
+    booleval::evaluator evaluator
+    {
+        {
+            booleval::make_field( "field_1", &baz::value_1 ),
+            booleval::make_field( "field_2", &baz::value_2 ),
+            booleval::make_field( "field_3", &baz::value_3 ),
+            booleval::make_field( "field_4", &baz::value_4 )
+        }
+    };
+
+    evaluation_without_allocations( state, evaluator );
+}
+
+BENCHMARK( EvaluationWithoutAllocations );
+
+void TypedEvaluationWithoutAllocations( benchmark::State & state )
+{
+    booleval::typed_evaluator< baz > evaluator
+    {
+        { "field_1", &baz::value_1 },
+        { "field_2", &baz::value_2 },
+        { "field_3", &baz::value_3 },
+        { "field_4", &baz::value_4 }
+    };
+
+    evaluation_without_allocations( state, evaluator );
+}
+
+BENCHMARK( TypedEvaluationWithoutAllocations );
+
 BENCHMARK_MAIN();
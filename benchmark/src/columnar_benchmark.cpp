@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <vector>
+#include <cstdint>
+#include <benchmark/benchmark.h>
+#include <booleval/columnar/evaluator.hpp>
+
+namespace
+{
+
+    struct quotes
+    {
+        std::vector< std::int32_t > ids;
+        std::vector< double       > prices;
+        std::vector< std::int64_t > volumes;
+    };
+
+    quotes const & columns()
+    {
+        static quotes const result
+        {
+            []
+            {
+                quotes values;
+                for ( std::uint32_t i{ 0u }; i < 4096u; ++i )
+                {
+                    values.ids    .push_back( static_cast< std::int32_t >( i % 10u )        );
+                    values.prices .push_back( 90.0 + i % 20u                                );
+                    values.volumes.push_back( static_cast< std::int64_t >( 500u * ( i % 4u ) ) );
+                }
+                return values;
+            }()
+        };
+
+        return result;
+    }
+
+    void columnar_evaluation( benchmark::State & state, char const * const expression )
+    {
+        auto const & values{ columns() };
+
+        booleval::columnar::evaluator evaluator
+        {
+            { "id",     booleval::columnar::column_type::int32   },
+            { "price",  booleval::columnar::column_type::float64 },
+            { "volume", booleval::columnar::column_type::int64   }
+        };
+
+        if ( !evaluator.expression( expression ) ) { state.SkipWithError( "Invalid expression" ); }
+
+        auto const isa{ static_cast< booleval::columnar::instruction_set >( state.range( 0 ) ) };
+        if ( isa > booleval::columnar::supported_instruction_set() ) { state.SkipWithError( "Instruction set not supported" ); }
+        evaluator.kernels( isa );
+
+        booleval::columnar::batch const rows
+        {
+            std::size( values.ids ),
+            {
+                std::data( values.ids     ),
+                std::data( values.prices  ),
+                std::data( values.volumes )
+            }
+        };
+
+        booleval::utils::bitmap selection{};
+
+        for ( auto _ : state )
+        {
+            evaluator.evaluate( rows, selection );
+            benchmark::DoNotOptimize( selection.data() );
+        }
+
+        state.SetItemsProcessed( static_cast< std::int64_t >( state.iterations() * rows.size() ) );
+    }
+
+} // namespace
+
+// argument is the instruction set: 0 - scalar, 1 - SSE4.2, 2 - AVX2
+void ColumnarSinglePredicate( benchmark::State & state )
+{
+    columnar_evaluation( state, "price gt 99.5" );
+}
+
+BENCHMARK( ColumnarSinglePredicate )->DenseRange( 0, 2 );
+
+void ColumnarConjunction( benchmark::State & state )
+{
+    columnar_evaluation( state, "id lt 5 and price gt 95.5 and volume geq 1000" );
+}
+
+BENCHMARK( ColumnarConjunction )->DenseRange( 0, 2 );
+
+BENCHMARK_MAIN();
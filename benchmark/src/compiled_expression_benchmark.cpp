@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <benchmark/benchmark.h>
+#include <booleval/compiled_expression.hpp>
+
+namespace
+{
+
+    struct quote
+    {
+        std::uint32_t id;
+        double        price;
+        std::uint64_t volume;
+
+        std::uint32_t get_id    () const noexcept { return id;     }
+        double        get_price () const noexcept { return price;  }
+        std::uint64_t get_volume() const noexcept { return volume; }
+    };
+
+    auto const expression{ "id in (3, 5, 7) and price gt 99.5 and volume geq 1000" };
+
+    std::vector< quote > const & quotes()
+    {
+        static std::vector< quote > const result
+        {
+            []
+            {
+                std::vector< quote > values;
+                for ( std::uint32_t i{ 0u }; i < 4096u; ++i )
+                {
+                    values.push_back( { i % 10u, 90.0 + i % 20u, 500u * ( i % 4u ) } );
+                }
+                return values;
+            }()
+        };
+
+        return result;
+    }
+
+    template< typename Expression >
+    void shared_evaluation( benchmark::State & state, std::shared_ptr< Expression const > const & compiled )
+    {
+        auto const & values{ quotes() };
+
+        for ( auto _ : state )
+        {
+            std::size_t matches{ 0u };
+            for ( auto const & value : values )
+            {
+                matches += compiled->evaluate( value ).success ? 1u : 0u;
+            }
+            benchmark::DoNotOptimize( matches );
+        }
+
+        state.SetItemsProcessed( static_cast< std::int64_t >( state.iterations() * std::size( values ) ) );
+    }
+
+} // namespace
+
+// one compiled expression is evaluated by all the threads at the same time
+void SharedEvaluation( benchmark::State & state )
+{
+    static auto const compiled
+    {
+        booleval::compiled_expression::compile
+        (
+            expression,
+            {
+                booleval::make_field( "id",     &quote::get_id     ),
+                booleval::make_field( "price",  &quote::get_price  ),
+                booleval::make_field( "volume", &quote::get_volume )
+            }
+        )
+    };
+
+    shared_evaluation( state, compiled );
+}
+
+BENCHMARK( SharedEvaluation )->ThreadRange( 1, 8 )->UseRealTime();
+
+void SharedTypedEvaluation( benchmark::State & state )
+{
+    static auto const compiled
+    {
+        booleval::typed_compiled_expression< quote >::compile
+        (
+            expression,
+            {
+                { "id",     &quote::get_id     },
+                { "price",  &quote::get_price  },
+                { "volume", &quote::get_volume }
+            }
+        )
+    };
+
+    shared_evaluation( state, compiled );
+}
+
+BENCHMARK( SharedTypedEvaluation )->ThreadRange( 1, 8 )->UseRealTime();
+
+// each test of the expression is run across the whole vector of records at once
+void BatchEvaluation( benchmark::State & state )
+{
+    auto const compiled
+    {
+        booleval::compiled_expression::compile
+        (
+            expression,
+            {
+                booleval::make_field( "id",     &quote::get_id     ),
+                booleval::make_field( "price",  &quote::get_price  ),
+                booleval::make_field( "volume", &quote::get_volume )
+            }
+        )
+    };
+
+    auto const & values{ quotes() };
+    booleval::utils::bitmap selection{};
+
+    for ( auto _ : state )
+    {
+        compiled->evaluate_batch( values, selection );
+        benchmark::DoNotOptimize( selection.data() );
+    }
+
+    state.SetItemsProcessed( static_cast< std::int64_t >( state.iterations() * std::size( values ) ) );
+}
+
+BENCHMARK( BatchEvaluation );
+
+void TypedBatchEvaluation( benchmark::State & state )
+{
+    auto const compiled
+    {
+        booleval::typed_compiled_expression< quote >::compile
+        (
+            expression,
+            {
+                { "id",     &quote::get_id     },
+                { "price",  &quote::get_price  },
+                { "volume", &quote::get_volume }
+            }
+        )
+    };
+
+    auto const & values{ quotes() };
+    booleval::utils::bitmap selection{};
+
+    for ( auto _ : state )
+    {
+        compiled->evaluate_batch( values, selection );
+        benchmark::DoNotOptimize( selection.data() );
+    }
+
+    state.SetItemsProcessed( static_cast< std::int64_t >( state.iterations() * std::size( values ) ) );
+}
+
+BENCHMARK( TypedBatchEvaluation );
+
+BENCHMARK_MAIN();
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <string>
+#include <sstream>
+#include <benchmark/benchmark.h>
+
+#include <booleval/field.hpp>
+#include <booleval/tree/tree.hpp>
+#include <booleval/tree/arena.hpp>
+#include <booleval/tree/result_visitor.hpp>
+#include <booleval/bytecode/program.hpp>
+#include <booleval/bytecode/compiler.hpp>
+#include <booleval/bytecode/interpreter.hpp>
+
+namespace
+{
+
+    template< typename T, typename U >
+    class bar
+    {
+    public:
+        bar( T && value_1, U && value_2 )
+        : value_1_{ value_1 }
+        , value_2_{ value_2 }
+        {}
+
+        T value_1() const noexcept { return value_1_; }
+        U value_2() const noexcept { return value_2_; }
+
+    private:
+        T value_1_{};
+        U value_2_{};
+    };
+
+    using object = bar< std::string, unsigned >;
+
+    // Generates expression like: "field_1 value0 or field_1 value1 or ... or field_1 valueN-1"
+    std::string generate_chain( std::size_t const count )
+    {
+        std::ostringstream oss;
+        for ( std::size_t i{ 0u }; i < count; ++i )
+        {
+            if ( i != 0u ) { oss << " or "; }
+            oss << "field_1 value" << i;
+        }
+        return oss.str();
+    }
+
+    void tree_engine( benchmark::State & state, std::string const & expression, object obj )
+    {
+        booleval::tree::result_visitor visitor;
+        visitor.fields
+        (
+            {
+                booleval::make_field( "field_1", &object::value_1 ),
+                booleval::make_field( "field_2", &object::value_2 )
+            }
+        );
+
+        booleval::tree::arena arena;
+        [[ maybe_unused ]] auto const success{ booleval::tree::build( expression, arena ) };
+
+        for ( auto _ : state )
+        {
+            auto const result{ visitor.visit( arena, obj ) };
+            benchmark::DoNotOptimize( result );
+        }
+    }
+
+    void bytecode_engine( benchmark::State & state, std::string const & expression, object obj )
+    {
+        booleval::bytecode::interpreter interpreter;
+        interpreter.fields
+        (
+            {
+                booleval::make_field( "field_1", &object::value_1 ),
+                booleval::make_field( "field_2", &object::value_2 )
+            }
+        );
+
+        booleval::tree::arena       arena;
+        booleval::bytecode::program program;
+        [[ maybe_unused ]] auto const success
+        {
+            booleval::tree::build( expression, arena ) &&
+            booleval::bytecode::compile( arena, program ) &&
+            interpreter.bind( program )
+        };
+
+        for ( auto _ : state )
+        {
+            auto const result{ interpreter.run( program, obj ) };
+            benchmark::DoNotOptimize( result );
+        }
+    }
+
+    auto const nested_expression{ "(field_1 foo and field_2 1) or (field_1 qux and field_2 2)" };
+
+} // namespace
+
+void TreeEngine_Nested( benchmark::State & state )
+{
+    tree_engine( state, nested_expression, object{ "qux", 2 } );
+}
+
+BENCHMARK( TreeEngine_Nested );
+
+void BytecodeEngine_Nested( benchmark::State & state )
+{
+    bytecode_engine( state, nested_expression, object{ "qux", 2 } );
+}
+
+BENCHMARK( BytecodeEngine_Nested );
+
+void TreeEngine_OrChain_LastMatch( benchmark::State & state )
+{
+    auto const count{ static_cast< std::size_t >( state.range( 0 ) ) };
+    tree_engine( state, generate_chain( count ), object{ "value" + std::to_string( count - 1 ), 0 } );
+}
+
+BENCHMARK( TreeEngine_OrChain_LastMatch )->Arg( 10 )->Arg( 100 )->Arg( 1000 );
+
+void BytecodeEngine_OrChain_LastMatch( benchmark::State & state )
+{
+    auto const count{ static_cast< std::size_t >( state.range( 0 ) ) };
+    bytecode_engine( state, generate_chain( count ), object{ "value" + std::to_string( count - 1 ), 0 } );
+}
+
+BENCHMARK( BytecodeEngine_OrChain_LastMatch )->Arg( 10 )->Arg( 100 )->Arg( 1000 );
+
+BENCHMARK_MAIN();
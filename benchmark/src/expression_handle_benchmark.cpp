@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <vector>
+#include <cstdint>
+#include <benchmark/benchmark.h>
+#include <booleval/expression_handle.hpp>
+
+namespace
+{
+
+    struct quote
+    {
+        std::uint32_t id;
+        double        price;
+        std::uint64_t volume;
+
+        std::uint32_t get_id    () const noexcept { return id;     }
+        double        get_price () const noexcept { return price;  }
+        std::uint64_t get_volume() const noexcept { return volume; }
+    };
+
+    std::vector< quote > const & quotes()
+    {
+        static std::vector< quote > const result
+        {
+            []
+            {
+                std::vector< quote > values;
+                for ( std::uint32_t i{ 0u }; i < 4096u; ++i )
+                {
+                    values.push_back( { i % 10u, 90.0 + i % 20u, 500u * ( i % 4u ) } );
+                }
+                return values;
+            }()
+        };
+
+        return result;
+    }
+
+    auto compile( char const * const expression )
+    {
+        return booleval::compiled_expression::compile
+        (
+            expression,
+            {
+                booleval::make_field( "id",     &quote::get_id     ),
+                booleval::make_field( "price",  &quote::get_price  ),
+                booleval::make_field( "volume", &quote::get_volume )
+            }
+        );
+    }
+
+    booleval::expression_handle & handle()
+    {
+        static booleval::expression_handle result{ compile( "id in (3, 5, 7) and price gt 99.5 and volume geq 1000" ) };
+        return result;
+    }
+
+    // every record goes through the handle, as an ingest thread would do
+    std::int64_t evaluate_records( booleval::expression_handle::reader const & reader )
+    {
+        auto const & values{ quotes() };
+
+        std::size_t matches{ 0u };
+        for ( auto const & value : values )
+        {
+            matches += reader.evaluate( value ).success ? 1u : 0u;
+        }
+        benchmark::DoNotOptimize( matches );
+
+        return static_cast< std::int64_t >( std::size( values ) );
+    }
+
+} // namespace
+
+void HandleEvaluation( benchmark::State & state )
+{
+    auto const reader{ handle().make_reader() };
+
+    std::int64_t records{ 0 };
+    for ( auto _ : state )
+    {
+        records += evaluate_records( reader );
+    }
+
+    state.SetItemsProcessed( records );
+}
+
+BENCHMARK( HandleEvaluation )->ThreadRange( 1, 8 )->UseRealTime();
+
+// the first thread keeps publishing new expressions while the others evaluate
+void HandleEvaluationWithPublish( benchmark::State & state )
+{
+    auto const first { compile( "id in (3, 5, 7) and price gt 99.5 and volume geq 1000" ) };
+    auto const second{ compile( "id in (2, 4, 6) and price lt 99.5 and volume lt 1000"  ) };
+
+    auto const reader{ handle().make_reader() };
+
+    std::size_t  publishes{ 0u };
+    std::int64_t records  { 0  };
+    for ( auto _ : state )
+    {
+        if ( state.thread_index() == 0 )
+        {
+            handle().publish( ++publishes % 2 == 0 ? first : second );
+        }
+        else
+        {
+            records += evaluate_records( reader );
+        }
+    }
+
+    state.SetItemsProcessed( records );
+}
+
+BENCHMARK( HandleEvaluationWithPublish )->ThreadRange( 2, 8 )->UseRealTime();
+
+BENCHMARK_MAIN();
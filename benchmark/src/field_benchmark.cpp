@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <benchmark/benchmark.h>
+#include <booleval/evaluator.hpp>
+
+namespace
+{
+
+    struct quote
+    {
+        std::uint32_t id;
+        double        price;
+        std::uint64_t volume;
+
+        std::uint32_t get_id    () const noexcept { return id;     }
+        double        get_price () const noexcept { return price;  }
+        std::uint64_t get_volume() const noexcept { return volume; }
+    };
+
+    auto const expression{ "id 7 and price gt 99.5 and volume geq 1000" };
+
+    template< typename Evaluator >
+    void evaluation( benchmark::State & state, Evaluator & evaluator )
+    {
+        [[ maybe_unused ]] auto const success{ evaluator.expression( expression ) };
+
+        quote x{ 7, 100.25, 5000 };
+
+        for ( auto _ : state )
+        {
+            auto const result{ evaluator.evaluate( x ) };
+            benchmark::DoNotOptimize( result );
+            benchmark::DoNotOptimize( x      );
+        }
+    }
+
+} // namespace
+
+void Getters( benchmark::State & state )
+{
+    booleval::evaluator evaluator
+    {
+        {
+            booleval::make_field( "id",     &quote::get_id     ),
+            booleval::make_field( "price",  &quote::get_price  ),
+            booleval::make_field( "volume", &quote::get_volume )
+        }
+    };
+
+    evaluation( state, evaluator );
+}
+
+BENCHMARK( Getters );
+
+void DataMembers( benchmark::State & state )
+{
+    booleval::evaluator evaluator
+    {
+        {
+            booleval::make_field( "id",     &quote::id     ),
+            booleval::make_field( "price",  &quote::price  ),
+            booleval::make_field( "volume", &quote::volume )
+        }
+    };
+
+    evaluation( state, evaluator );
+}
+
+BENCHMARK( DataMembers );
+
+void TypedGetters( benchmark::State & state )
+{
+    booleval::typed_evaluator< quote > evaluator
+    {
+        { "id",     &quote::get_id     },
+        { "price",  &quote::get_price  },
+        { "volume", &quote::get_volume }
+    };
+
+    evaluation( state, evaluator );
+}
+
+BENCHMARK( TypedGetters );
+
+void TypedDataMembers( benchmark::State & state )
+{
+    booleval::typed_evaluator< quote > evaluator
+    {
+        { "id",     &quote::id     },
+        { "price",  &quote::price  },
+        { "volume", &quote::volume }
+    };
+
+    evaluation( state, evaluator );
+}
+
+BENCHMARK( TypedDataMembers );
+
+void TypedOffsets( benchmark::State & state )
+{
+    booleval::typed_evaluator< quote > evaluator
+    {
+        { "id",     booleval::field_offset< std::uint32_t >{ offsetof( quote, id     ) } },
+        { "price",  booleval::field_offset< double        >{ offsetof( quote, price  ) } },
+        { "volume", booleval::field_offset< std::uint64_t >{ offsetof( quote, volume ) } }
+    };
+
+    evaluation( state, evaluator );
+}
+
+BENCHMARK( TypedOffsets );
+
+BENCHMARK_MAIN();
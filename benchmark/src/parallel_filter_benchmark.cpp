@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <vector>
+#include <cstdint>
+#include <benchmark/benchmark.h>
+#include <booleval/parallel_filter.hpp>
+#include <booleval/compiled_expression.hpp>
+
+namespace
+{
+
+    struct quote
+    {
+        std::uint32_t id;
+        double        price;
+        std::uint64_t volume;
+
+        std::uint32_t get_id    () const noexcept { return id;     }
+        double        get_price () const noexcept { return price;  }
+        std::uint64_t get_volume() const noexcept { return volume; }
+    };
+
+    std::vector< quote > const & quotes()
+    {
+        static std::vector< quote > const result
+        {
+            []
+            {
+                std::vector< quote > values;
+                for ( std::uint32_t i{ 0u }; i < 1u << 20; ++i )
+                {
+                    values.push_back( { i % 10u, 90.0 + i % 20u, 500u * ( i % 4u ) } );
+                }
+                return values;
+            }()
+        };
+
+        return result;
+    }
+
+    auto const & compiled()
+    {
+        static auto const result
+        {
+            booleval::typed_compiled_expression< quote >::compile
+            (
+                "id in (3, 5, 7) and price gt 99.5 and volume geq 1000",
+                {
+                    { "id",     &quote::get_id     },
+                    { "price",  &quote::get_price  },
+                    { "volume", &quote::get_volume }
+                }
+            )
+        };
+
+        return result;
+    }
+
+} // namespace
+
+// argument is the number of the threads of the pool
+void ParallelFilter( benchmark::State & state )
+{
+    auto const & values    { quotes()   };
+    auto const & expression{ compiled() };
+
+    booleval::thread_pool pool{ static_cast< std::size_t >( state.range( 0 ) ) };
+
+    for ( auto _ : state )
+    {
+        benchmark::DoNotOptimize( booleval::parallel_filter( values, *expression, pool ) );
+    }
+
+    state.SetItemsProcessed( static_cast< std::int64_t >( state.iterations() * std::size( values ) ) );
+}
+
+BENCHMARK( ParallelFilter )->RangeMultiplier( 2 )->Range( 1, 8 )->UseRealTime()->Unit( benchmark::kMillisecond );
+
+void ParallelCount( benchmark::State & state )
+{
+    auto const & values    { quotes()   };
+    auto const & expression{ compiled() };
+
+    booleval::thread_pool pool{ static_cast< std::size_t >( state.range( 0 ) ) };
+
+    for ( auto _ : state )
+    {
+        benchmark::DoNotOptimize( booleval::parallel_count( values, *expression, pool ) );
+    }
+
+    state.SetItemsProcessed( static_cast< std::int64_t >( state.iterations() * std::size( values ) ) );
+}
+
+BENCHMARK( ParallelCount )->RangeMultiplier( 2 )->Range( 1, 8 )->UseRealTime()->Unit( benchmark::kMillisecond );
+
+BENCHMARK_MAIN();
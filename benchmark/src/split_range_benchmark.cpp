@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <string>
+#include <cstdint>
+#include <string_view>
+#include <benchmark/benchmark.h>
+
+#include <booleval/utils/split_range.hpp>
+#include <booleval/utils/split_options.hpp>
+
+namespace
+{
+
+    using booleval::utils::split_options;
+
+    constexpr auto lexer_options
+    {
+        split_options::include_delimiters  |
+        split_options::split_by_whitespace |
+        split_options::allow_quoted_strings
+    };
+
+    constexpr std::string_view delimiters{ "()," };
+
+    // Generates expression like: "(field_0 eq 0 or field_1 in (1, 2)) and field_2 neq "text" and ..." having at least
+    // the specified number of characters, where field names and quoted strings have the specified number of characters
+    std::string generate( std::size_t const size, std::size_t const length )
+    {
+        std::string const name  ( length, 'f' );
+        std::string const quoted( length, 'q' );
+
+        std::string result;
+        for ( std::size_t i{ 0u }; std::size( result ) < size; ++i )
+        {
+            if ( i != 0u ) { result += " and "; }
+
+            result += "(" + name + std::to_string( i ) + " eq " + std::to_string( i ) + " or ";
+            result += name + " in (1, 2, 3)) and " + name + " neq \"" + quoted + " " + quoted + "\"";
+        }
+
+        return result;
+    }
+
+    template< split_options options >
+    void Split( benchmark::State & state )
+    {
+        auto const expression
+        {
+            generate
+            (
+                static_cast< std::size_t >( state.range( 0 ) ),
+                static_cast< std::size_t >( state.range( 1 ) )
+            )
+        };
+
+        std::size_t tokens{ 0u };
+
+        for ( auto _ : state )
+        {
+            tokens = 0u;
+            for ( auto const [ is_quoted, value ] : booleval::utils::split_range< options >( expression, delimiters ) )
+            {
+                benchmark::DoNotOptimize( value );
+                ++tokens;
+            }
+        }
+
+        state.counters[ "tokens" ] = static_cast< double >( tokens );
+        state.SetBytesProcessed( static_cast< std::int64_t >( state.iterations() * std::size( expression ) ) );
+    }
+
+    void arguments( benchmark::internal::Benchmark * benchmark )
+    {
+        for ( auto const size : { 1 << 12, 1 << 14, 1 << 16 } )
+        {
+            for ( auto const length : { 8, 64 } )
+            {
+                benchmark->Args( { size, length } );
+            }
+        }
+    }
+
+} // namespace
+
+BENCHMARK_TEMPLATE( Split, lexer_options                            )->Apply( arguments );
+BENCHMARK_TEMPLATE( Split, lexer_options | split_options::vectorized )->Apply( arguments );
+
+BENCHMARK_MAIN();
@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <map>
+#include <cmath>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <string_view>
+#include <benchmark/benchmark.h>
+
+#include <booleval/tree/tree.hpp>
+#include <booleval/tree/arena.hpp>
+#include <booleval/compiled_expression.hpp>
+#include <booleval/token/token.hpp>
+#include <booleval/token/token_type.hpp>
+#include <booleval/token/token_type_utils.hpp>
+
+namespace
+{
+
+    using booleval::token::token_type;
+
+    /**
+     * Expression generated together with its tokens, so tokenizing is left out of the measurement.
+     */
+    class expression
+    {
+    public:
+        void append( token_type const type, std::string_view const value )
+        {
+            if ( !text_.empty() ) { text_ += ' '; }
+            spans_.push_back( { type, std::size( text_ ), std::size( value ) } );
+            text_ += value;
+        }
+
+        void append( token_type const type )
+        {
+            append( type, booleval::token::to_token_keyword( type ) );
+        }
+
+        [[ nodiscard ]] std::string const & text() const noexcept { return text_; }
+
+        [[ nodiscard ]] std::vector< booleval::token::token > tokens( std::string_view const text ) const
+        {
+            std::vector< booleval::token::token > result;
+            result.reserve( std::size( spans_ ) );
+
+            for ( auto const & span : spans_ )
+            {
+                result.emplace_back( span.type, text.substr( span.offset, span.length ) );
+            }
+
+            return result;
+        }
+
+    private:
+        struct span
+        {
+            token_type  type;
+            std::size_t offset;
+            std::size_t length;
+        };
+
+        std::string         text_ {};
+        std::vector< span > spans_{};
+    };
+
+    void relation( expression & e, std::string_view const field, std::size_t const value )
+    {
+        e.append( token_type::field, field );
+        e.append( token_type::eq            );
+        e.append( token_type::field, std::to_string( value ) );
+    }
+
+    // Generates expression like: "field_a eq 0 or field_b eq 1 or ..." having roughly the specified number of tokens
+    expression generate_chain( std::size_t const tokens )
+    {
+        expression e;
+        for ( std::size_t i{ 0u }; i == 0u || i * 4u < tokens; ++i )
+        {
+            if ( i != 0u ) { e.append( token_type::logical_or ); }
+            relation( e, i % 2u == 0u ? "field_a" : "field_b", i );
+        }
+        return e;
+    }
+
+    // Generates expression like: "(field_a eq 0 and (field_b eq 1 or (...)))" having roughly the specified number of tokens
+    expression generate_nested( std::size_t const tokens )
+    {
+        expression  e;
+        std::size_t depth{ 0u };
+        for ( ; depth == 0u || depth * 6u < tokens; ++depth )
+        {
+            e.append( token_type::lp );
+            relation( e, "field_a", depth );
+            e.append( depth % 2u == 0u ? token_type::logical_and : token_type::logical_or );
+        }
+        relation( e, "field_b", 0u );
+        for ( std::size_t i{ 0u }; i < depth; ++i )
+        {
+            e.append( token_type::rp );
+        }
+        return e;
+    }
+
+    void parse( benchmark::State & state, expression const & e )
+    {
+        booleval::tree::arena arena;
+
+        auto const tokens{ e.tokens( arena.text( e.text() ) ) };
+
+        for ( auto _ : state )
+        {
+            // text is assigned into the same buffer, so the tokens keep referring to it
+            arena.clear();
+            arena.text( e.text() );
+
+            booleval::tree::internal::token_cursor cursor{ tokens };
+
+            auto const root{ booleval::tree::internal::parse( cursor, arena ) };
+            benchmark::DoNotOptimize( root );
+
+            if ( root == booleval::tree::null_node )
+            {
+                state.SkipWithError( "Invalid expression" );
+                break;
+            }
+        }
+
+        state.SetComplexityN( static_cast< std::int64_t >( std::size( tokens ) ) );
+        state.counters[ "tokens" ] = static_cast< double >( std::size( tokens ) );
+        state.SetItemsProcessed( static_cast< std::int64_t >( state.iterations() * std::size( tokens ) ) );
+    }
+
+    void build( benchmark::State & state, expression const & e )
+    {
+        booleval::tree::arena arena;
+
+        for ( auto _ : state )
+        {
+            auto const success{ booleval::tree::build( e.text(), arena ) };
+            benchmark::DoNotOptimize( success );
+
+            if ( !success )
+            {
+                state.SkipWithError( "Invalid expression" );
+                break;
+            }
+        }
+
+        auto const tokens{ std::size( e.tokens( e.text() ) ) };
+
+        state.SetComplexityN( static_cast< std::int64_t >( tokens ) );
+        state.counters[ "tokens" ] = static_cast< double >( tokens );
+        state.SetItemsProcessed( static_cast< std::int64_t >( state.iterations() * tokens ) );
+    }
+
+    /**
+     * Compiles the expression the same way the evaluator does, i.e. builds the tree,
+     * optimizes it and compiles it into the program, so the whole pipeline is measured.
+     */
+    void compile( benchmark::State & state, expression const & e )
+    {
+        booleval::tree::arena       parsed;
+        booleval::tree::arena       tree;
+        booleval::bytecode::program program;
+
+        for ( auto _ : state )
+        {
+            auto const success{ booleval::internal::compile( e.text(), parsed, tree, program ) };
+            benchmark::DoNotOptimize( success );
+
+            if ( !success )
+            {
+                state.SkipWithError( "Invalid expression" );
+                break;
+            }
+        }
+
+        auto const tokens{ std::size( e.tokens( e.text() ) ) };
+
+        state.SetComplexityN( static_cast< std::int64_t >( tokens ) );
+        state.counters[ "tokens" ] = static_cast< double >( tokens );
+        state.SetItemsProcessed( static_cast< std::int64_t >( state.iterations() * tokens ) );
+    }
+
+    /**
+     * Growth exponent above which the time is considered superlinear in the number of the tokens.
+     */
+    constexpr double max_exponent{ 1.1 };
+
+    /**
+     * @class growth_reporter
+     *
+     * Represents the console reporter that additionally fits the time of each benchmark family
+     * against its complexity N as 'time = c * N^k' and reports the families whose exponent k
+     * exceeds the maximal one, so the benchmark fails once parsing stops being linear.
+     */
+    class growth_reporter : public benchmark::ConsoleReporter
+    {
+    public:
+        void ReportRuns( std::vector< Run > const & reports ) override
+        {
+            benchmark::ConsoleReporter::ReportRuns( reports );
+
+            for ( auto const & run : reports )
+            {
+                if ( run.run_type != Run::RT_Iteration || run.complexity_n <= 0 ) { continue; }
+
+                auto & points{ families_[ run.run_name.function_name ] };
+                points.emplace_back
+                (
+                    std::log( static_cast< double >( run.complexity_n ) ),
+                    std::log( run.GetAdjustedCPUTime() )
+                );
+            }
+        }
+
+        /**
+         * Fits the growth exponent of each benchmark family by the least squares method.
+         *
+         * @return True if all the exponents are below the maximal one, false otherwise
+         */
+        [[ nodiscard ]] bool check() const
+        {
+            auto success{ true };
+
+            for ( auto const & [ name, points ] : families_ )
+            {
+                if ( std::size( points ) < 2u ) { continue; }
+
+                auto const n{ static_cast< double >( std::size( points ) ) };
+
+                double sx { 0.0 };
+                double sy { 0.0 };
+                double sxx{ 0.0 };
+                double sxy{ 0.0 };
+
+                for ( auto const & [ x, y ] : points )
+                {
+                    sx  += x;
+                    sy  += y;
+                    sxx += x * x;
+                    sxy += x * y;
+                }
+
+                auto const exponent{ ( n * sxy - sx * sy ) / ( n * sxx - sx * sx ) };
+                auto const linear  { exponent <= max_exponent };
+
+                GetOutputStream()
+                    << std::left << std::setw( 24 ) << name
+                    << "growth exponent " << std::fixed << std::setprecision( 2 ) << exponent
+                    << ( linear ? "" : " (superlinear)" ) << '\n';
+
+                success = success && linear;
+            }
+
+            return success;
+        }
+
+    private:
+        std::map< std::string, std::vector< std::pair< double, double > > > families_{};
+    };
+
+} // namespace
+
+void ParseChain( benchmark::State & state )
+{
+    parse( state, generate_chain( static_cast< std::size_t >( state.range( 0 ) ) ) );
+}
+
+BENCHMARK( ParseChain )->RangeMultiplier( 8 )->Range( 64, 1 << 20 )->Complexity( benchmark::oN );
+
+void ParseNested( benchmark::State & state )
+{
+    parse( state, generate_nested( static_cast< std::size_t >( state.range( 0 ) ) ) );
+}
+
+BENCHMARK( ParseNested )->RangeMultiplier( 8 )->Range( 64, 1 << 20 )->Complexity( benchmark::oN );
+
+void BuildChain( benchmark::State & state )
+{
+    build( state, generate_chain( static_cast< std::size_t >( state.range( 0 ) ) ) );
+}
+
+BENCHMARK( BuildChain )->RangeMultiplier( 4 )->Range( 1 << 10, 1 << 18 )->Complexity( benchmark::oN );
+
+void BuildNested( benchmark::State & state )
+{
+    build( state, generate_nested( static_cast< std::size_t >( state.range( 0 ) ) ) );
+}
+
+BENCHMARK( BuildNested )->RangeMultiplier( 4 )->Range( 1 << 10, 1 << 18 )->Complexity( benchmark::oN );
+
+void CompileChain( benchmark::State & state )
+{
+    compile( state, generate_chain( static_cast< std::size_t >( state.range( 0 ) ) ) );
+}
+
+BENCHMARK( CompileChain )->RangeMultiplier( 4 )->Range( 1 << 10, 1 << 18 )->Complexity( benchmark::oN );
+
+void CompileNested( benchmark::State & state )
+{
+    compile( state, generate_nested( static_cast< std::size_t >( state.range( 0 ) ) ) );
+}
+
+BENCHMARK( CompileNested )->RangeMultiplier( 4 )->Range( 1 << 10, 1 << 18 )->Complexity( benchmark::oN );
+
+int main( int argc, char ** argv )
+{
+    benchmark::Initialize( &argc, argv );
+    if ( benchmark::ReportUnrecognizedArguments( argc, argv ) ) { return 1; }
+
+    growth_reporter reporter;
+    benchmark::RunSpecifiedBenchmarks( &reporter );
+    benchmark::Shutdown();
+
+    return reporter.check() ? 0 : 1;
+}
@@ -62,6 +62,33 @@ namespace
         return oss.str();
     }
 
+    // Helper function to generate expression like: "field in (v1, v2, ..., vN)"
+    std::string generate_set_expression( const std::string& field_name, const std::vector<std::string>& values )
+    {
+        if ( values.empty() ) return "";
+
+        std::ostringstream oss;
+        oss << field_name << " in (" << values[0];
+
+        for ( size_t i = 1; i < values.size(); ++i )
+        {
+            oss << ", " << values[i];
+        }
+
+        oss << ")";
+        return oss.str();
+    }
+
+    std::vector<std::string> generate_values( int const count )
+    {
+        std::vector<std::string> values;
+        for ( int i = 1; i <= count; ++i )
+        {
+            values.push_back( "value" + std::to_string( i ) );
+        }
+        return values;
+    }
+
 } // namespace
 
 // ============================================================================
@@ -198,6 +225,154 @@ void ParseOnceEvaluateMany_10Values( benchmark::State& state )
 
 BENCHMARK( ParseOnceEvaluateMany_10Values );
 
+// ============================================================================
+// Benchmark scenario: Small set of recurring expressions, parsed on every use
+// ============================================================================
+
+void RecurringExpressions( benchmark::State& state )
+{
+    booleval::evaluator evaluator
+    {
+        {
+            booleval::make_field( "field", &data_object< std::string >::value )
+        }
+    };
+    evaluator.cache_capacity( static_cast< std::size_t >( state.range( 0 ) ) );
+
+    std::vector< std::string > expressions;
+    for ( int i = 1; i <= 8; ++i )
+    {
+        expressions.push_back( generate_in_expression( "field", generate_values( i * 2 ) ) );
+    }
+
+    data_object< std::string > obj{ "value3" };
+
+    std::size_t i = 0;
+    for ( auto _ : state )
+    {
+        [[ maybe_unused ]] auto const success{ evaluator.expression( expressions[ i++ % expressions.size() ] ) };
+        [[ maybe_unused ]] auto const result{ evaluator.evaluate( obj ) };
+        benchmark::DoNotOptimize( result );
+        benchmark::ClobberMemory();
+    }
+
+    state.counters[ "hits"   ] = static_cast< double >( evaluator.cache().hits()   );
+    state.counters[ "misses" ] = static_cast< double >( evaluator.cache().misses() );
+}
+
+// cache disabled, cache smaller than the number of expressions, cache holding all of them
+BENCHMARK( RecurringExpressions )->Arg( 0 )->Arg( 4 )->Arg( 8 );
+
+// ============================================================================
+// Set membership written with IN operator
+// ============================================================================
+
+void ParseAndEvaluate_In( benchmark::State& state )
+{
+    booleval::evaluator evaluator
+    {
+        {
+            booleval::make_field( "field", &data_object< std::string >::value )
+        }
+    };
+
+    auto const count = static_cast< int >( state.range( 0 ) );
+
+    std::string expr = generate_set_expression( "field", generate_values( count ) );
+    data_object< std::string > obj{ "value" + std::to_string( count / 2 + 1 ) };  // Match in middle
+
+    for ( auto _ : state )
+    {
+        [[ maybe_unused ]] auto const success{ evaluator.expression( expr ) };
+        [[ maybe_unused ]] auto const result{ evaluator.evaluate( obj ) };
+        benchmark::DoNotOptimize( result );
+        benchmark::ClobberMemory();
+    }
+}
+
+BENCHMARK( ParseAndEvaluate_In )->Arg( 10 )->Arg( 50 );
+
+void ParseOnceEvaluateMany_In( benchmark::State& state )
+{
+    booleval::evaluator evaluator
+    {
+        {
+            booleval::make_field( "field", &data_object< std::string >::value )
+        }
+    };
+
+    auto const count = static_cast< int >( state.range( 0 ) );
+
+    std::string expr = generate_set_expression( "field", generate_values( count ) );
+
+    [[ maybe_unused ]] auto const success{ evaluator.expression( expr ) };
+    data_object< std::string > obj{ "value" + std::to_string( count / 2 + 1 ) };  // Match in middle
+
+    for ( auto _ : state )
+    {
+        [[ maybe_unused ]] auto const result{ evaluator.evaluate( obj ) };
+        benchmark::DoNotOptimize( result );
+        benchmark::ClobberMemory();
+    }
+}
+
+BENCHMARK( ParseOnceEvaluateMany_In )->Arg( 10 )->Arg( 50 )->Arg( 10000 );
+
+// OR-chain of equalities of the same field is folded into the IN operator
+void ParseOnceEvaluateMany_OrChain( benchmark::State& state )
+{
+    booleval::evaluator evaluator
+    {
+        {
+            booleval::make_field( "field", &data_object< std::string >::value )
+        }
+    };
+
+    auto const count = static_cast< int >( state.range( 0 ) );
+
+    std::string expr = generate_in_expression( "field", generate_values( count ) );
+
+    [[ maybe_unused ]] auto const success{ evaluator.expression( expr ) };
+    data_object< std::string > obj{ "value" + std::to_string( count / 2 + 1 ) };  // Match in middle
+
+    for ( auto _ : state )
+    {
+        [[ maybe_unused ]] auto const result{ evaluator.evaluate( obj ) };
+        benchmark::DoNotOptimize( result );
+        benchmark::ClobberMemory();
+    }
+}
+
+BENCHMARK( ParseOnceEvaluateMany_OrChain )->Arg( 10 )->Arg( 50 )->Arg( 1000 );
+
+// Values of the set are bound as the parameter instead of building the expression again
+void BindAndEvaluate_In( benchmark::State& state )
+{
+    booleval::evaluator evaluator
+    {
+        {
+            booleval::make_field( "field", &data_object< std::string >::value )
+        }
+    };
+
+    auto const count = static_cast< int >( state.range( 0 ) );
+
+    auto const values = generate_values( count );
+
+    [[ maybe_unused ]] auto const success{ evaluator.expression( "field in (?)" ) };
+    data_object< std::string > obj{ "value" + std::to_string( count / 2 + 1 ) };  // Match in middle
+
+    for ( auto _ : state )
+    {
+        [[ maybe_unused ]] auto const bound{ evaluator.parameter( 0, std::cbegin( values ), std::cend( values ) ) };
+        [[ maybe_unused ]] auto const result{ evaluator.evaluate( obj ) };
+        benchmark::DoNotOptimize( result );
+        benchmark::ClobberMemory();
+    }
+}
+
+BENCHMARK( BindAndEvaluate_In )->Arg( 10 )->Arg( 50 );
+
 // ============================================================================
 // Test short-circuit evaluation behavior
 // ============================================================================
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef BOOLEVAL_BATCH_HPP
+#define BOOLEVAL_BATCH_HPP
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+#include <booleval/utils/bitmap.hpp>
+#include <booleval/bytecode/program.hpp>
+#include <booleval/bytecode/instruction.hpp>
+
+namespace booleval::bytecode
+{
+
+/**
+ * Runs the program across the batch of rows. Each instruction is run across the whole batch
+ * at once rather than the whole program row by row. Instruction keeps the masks of the rows
+ * reaching it, one bit per row, and the jumps move the rows to the masks of their targets.
+ * Since all the jumps go forward, every instruction is run only once.
+ *
+ * Rows are processed in chunks, so the masks of one chunk stay in the cache. Test instructions
+ * are run by the test function, called once per chunk as
+ * test( instruction, first, rows, active, result ), where first is the index of the first row
+ * of the chunk, rows is the number of its rows, active are the masks of the rows reaching the
+ * test and result are the result registers the outcome of the test is stored into.
+ *
+ * @param program   Program to run
+ * @param size      Number of the rows
+ * @param selection Bitmap to set the bits of the rows satisfying the program in
+ * @param test      Test function
+ *
+ * @return True if the program is run, false if any of its parameters is not bound
+ */
+template< typename Test >
+bool run_batch( program const & program, std::size_t const size, utils::bitmap & selection, Test && test )
+{
+    selection.reset( size );
+
+    if ( !program.ready() ) { return false; }
+
+    constexpr auto        bits       { utils::bitmap::word_bits };
+    constexpr std::size_t chunk_words{ 64u };
+
+    std::vector< std::uint64_t > reach( ( program.size() + 1u ) * chunk_words );
+
+    for ( std::size_t first{ 0u }; first < selection.words(); first += chunk_words )
+    {
+        auto const words { std::min( chunk_words, selection.words() - first ) };
+        auto const rows  { std::min( words * bits, size - first * bits ) };
+        auto * const result{ selection.data() + first };
+
+        std::fill( std::begin( reach ), std::end( reach ), 0u );
+        std::fill( std::data( reach ), std::data( reach ) + words, ~std::uint64_t{ 0u } );
+
+        if ( rows % bits != 0u )
+        {
+            reach[ words - 1u ] = ( std::uint64_t{ 1u } << rows % bits ) - 1u;
+        }
+
+        for ( std::uint32_t pc{ 0u }; pc < program.size(); ++pc )
+        {
+            auto const & instruction{ program[ pc ] };
+
+            auto const * const active{ std::data( reach ) + pc * chunk_words };
+            auto       * const next  { std::data( reach ) + ( pc + 1u ) * chunk_words };
+
+            switch ( instruction.code )
+            {
+                case opcode::test:
+                    test( instruction, first * bits, rows, active, result );
+                    for ( std::size_t w{ 0u }; w < words; ++w ) { next[ w ] |= active[ w ]; }
+                    break;
+
+                case opcode::jump_if_true:
+                case opcode::jump_if_false:
+                {
+                    auto * const target{ std::data( reach ) + instruction.operand * chunk_words };
+
+                    // jump_if_false is taken by the rows whose result is false
+                    std::uint64_t const flip{ instruction.code == opcode::jump_if_true ? 0u : ~std::uint64_t{ 0u } };
+
+                    for ( std::size_t w{ 0u }; w < words; ++w )
+                    {
+                        target[ w ] |= active[ w ] &  ( result[ w ] ^ flip );
+                        next  [ w ] |= active[ w ] & ~( result[ w ] ^ flip );
+                    }
+                    break;
+                }
+
+                case opcode::fail:
+                    for ( std::size_t w{ 0u }; w < words; ++w )
+                    {
+                        result[ w ] &= ~active[ w ];
+                        next  [ w ] |=  active[ w ];
+                    }
+                    break;
+            }
+        }
+    }
+
+    return true;
+}
+
+} // namespace booleval::bytecode
+
+#endif // BOOLEVAL_BATCH_HPP
@@ -0,0 +1,446 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef BOOLEVAL_COMPILER_HPP
+#define BOOLEVAL_COMPILER_HPP
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+#include <booleval/tree/node.hpp>
+#include <booleval/tree/arena.hpp>
+#include <booleval/token/token_type.hpp>
+#include <booleval/bytecode/program.hpp>
+#include <booleval/bytecode/instruction.hpp>
+
+namespace booleval::bytecode
+{
+
+namespace internal
+{
+
+    // Forward declarations
+
+    void compile_node   ( tree::arena const & arena, tree::node_index const index, program & program );
+    void compile_operand( tree::arena const & arena, tree::node_index const index, program & program );
+    void compile_logical( tree::arena const & arena, tree::node_index const index, program & program );
+    void compile_set    ( tree::arena const & arena, tree::node       const & node, program & program );
+
+    // Definitions
+
+    [[ nodiscard ]] inline bool is_relational( token::token_type const type ) noexcept
+    {
+        switch ( type )
+        {
+            case token::token_type::eq :
+            case token::token_type::neq:
+            case token::token_type::gt :
+            case token::token_type::lt :
+            case token::token_type::geq:
+            case token::token_type::leq:
+            case token::token_type::in :
+            case token::token_type::not_in:
+                return true;
+
+            default:
+                return false;
+        }
+    }
+
+    [[ nodiscard ]] inline bool is_logical( tree::arena const & arena, tree::node_index const index ) noexcept
+    {
+        if ( index == tree::null_node || !arena[ index ].has_children() ) { return false; }
+
+        auto const type{ arena[ index ].type };
+        return type == token::token_type::logical_and || type == token::token_type::logical_or;
+    }
+
+    inline void compile_node( tree::arena const & arena, tree::node_index const index, program & program )
+    {
+        if ( is_logical( arena, index ) )
+        {
+            compile_logical( arena, index, program );
+        }
+        else
+        {
+            compile_operand( arena, index, program );
+        }
+    }
+
+    /**
+     * Compiles the operand that is not a logical operation, i.e. the relational
+     * or the set membership operation, or the failure if the operand is missing.
+     */
+    inline void compile_operand( tree::arena const & arena, tree::node_index const index, program & program )
+    {
+        if ( index == tree::null_node || !arena[ index ].has_children() )
+        {
+            program.emit( { opcode::fail, token::token_type::unknown, instruction::no_slot, program.message( "Missing operand" ) } );
+            return;
+        }
+
+        auto const & node{ arena[ index ] };
+
+        if ( node.type == token::token_type::in || node.type == token::token_type::not_in )
+        {
+            compile_set( arena, node, program );
+        }
+        else if ( is_relational( node.type ) )
+        {
+            auto const & right{ arena[ node.right ] };
+
+            program.emit
+            (
+                {
+                    opcode::test,
+                    node.type,
+                    instruction::no_slot,
+                    program.field( arena.value( arena[ node.left ] ) ),
+                    right.type == token::token_type::parameter
+                        ? program.placeholder( right.offset, false )
+                        : program.literal    ( arena.value( right ) )
+                }
+            );
+        }
+        else
+        {
+            program.emit( { opcode::fail, token::token_type::unknown, instruction::no_slot, program.message( "Unknown token type" ) } );
+        }
+    }
+
+    /**
+     * Compiles the set membership operation. Elements of the set are converted into
+     * the set of constants only once, so the lookup does not depend on their number.
+     * Set parameter is compiled into the placeholder set whose elements are bound later.
+     */
+    inline void compile_set( tree::arena const & arena, tree::node const & node, program & program )
+    {
+        auto const elements{ arena.list( arena[ node.right ] ) };
+
+        if ( std::size( elements ) == 1u && arena[ elements[ 0 ] ].type == token::token_type::parameter )
+        {
+            program.emit
+            (
+                {
+                    opcode::test,
+                    node.type,
+                    instruction::no_slot,
+                    program.field      ( arena.value( arena[ node.left ] ) ),
+                    program.placeholder( arena[ elements[ 0 ] ].offset, true )
+                }
+            );
+            return;
+        }
+
+        std::vector< utils::constant > constants;
+
+        for ( auto const element : elements )
+        {
+            constants.emplace_back( arena.value( arena[ element ] ) );
+        }
+
+        program.emit
+        (
+            {
+                opcode::test,
+                node.type,
+                instruction::no_slot,
+                program.field( arena.value( arena[ node.left ] ) ),
+                program.set  ( { std::cbegin( constants ), std::cend( constants ) } )
+            }
+        );
+    }
+
+    /**
+     * Logical operation being compiled along with its next operand and the position
+     * of its first jump on the jump stack.
+     */
+    struct logical_frame
+    {
+        tree::node_index index{ tree::null_node };
+        std::size_t      next { 0u              };
+        std::size_t      jumps{ 0u              };
+    };
+
+    /**
+     * Compiles the logical operation as a flat sequence of its operands separated
+     * by the conditional jumps to the end of the operation. Nested logical operations
+     * are kept on the explicit stack instead of the native call stack, so the nesting
+     * depth of the expression is not limited by the stack size.
+     */
+    inline void compile_logical( tree::arena const & arena, tree::node_index const index, program & program )
+    {
+        std::vector< logical_frame > frames{ { index, 0u, 0u } };
+        std::vector< std::uint32_t > jumps {};
+
+        while ( !frames.empty() )
+        {
+            auto &       top     { frames.back() };
+            auto const & node    { arena[ top.index ] };
+            auto const   operands{ arena.list( node ) };
+
+            if ( top.next == std::size( operands ) )
+            {
+                for ( auto j{ top.jumps }; j < std::size( jumps ); ++j )
+                {
+                    program[ jumps[ j ] ].operand = program.size();
+                }
+
+                jumps.resize( top.jumps );
+                frames.pop_back();
+                continue;
+            }
+
+            if ( top.next != 0u )
+            {
+                auto const jump
+                {
+                    node.type == token::token_type::logical_and ? opcode::jump_if_false : opcode::jump_if_true
+                };
+
+                jumps.push_back( program.emit( { jump } ) );
+            }
+
+            auto const operand{ operands[ top.next++ ] };
+
+            if ( is_logical( arena, operand ) )
+            {
+                frames.push_back( { operand, 0u, std::size( jumps ) } );
+            }
+            else
+            {
+                compile_operand( arena, operand, program );
+            }
+        }
+    }
+
+    /**
+     * Retargets jumps landing on other jumps. Landing on the jump with the same
+     * condition means that jump is going to be taken as well, while landing on the
+     * jump with the opposite condition means that jump is not going to be taken.
+     */
+    inline void thread_jumps( program & program ) noexcept
+    {
+        auto const is_jump
+        {
+            []( opcode const code ) noexcept
+            {
+                return code == opcode::jump_if_true || code == opcode::jump_if_false;
+            }
+        };
+
+        for ( auto i{ program.size() }; i-- > 0; )
+        {
+            auto & instruction{ program[ i ] };
+            if ( !is_jump( instruction.code ) ) { continue; }
+
+            auto target{ instruction.operand };
+            while ( target < program.size() && is_jump( program[ target ].code ) )
+            {
+                target = program[ target ].code == instruction.code
+                    ? program[ target ].operand
+                    : target + 1;
+            }
+            instruction.operand = target;
+        }
+    }
+
+    /**
+     * Finds the test run after the instruction at the given position, provided
+     * the result so far is the given one, or the end of the program if no test
+     * is run anymore.
+     */
+    [[ nodiscard ]] inline std::uint32_t next_test
+    (
+        program const & program,
+        std::uint32_t   pc,
+        bool            success
+    ) noexcept
+    {
+        while ( pc < program.size() )
+        {
+            auto const & instruction{ program[ pc ] };
+
+            switch ( instruction.code )
+            {
+                case opcode::test:          return pc;
+                case opcode::jump_if_true:  pc = success ? instruction.operand : pc + 1u; break;
+                case opcode::jump_if_false: pc = success ? pc + 1u : instruction.operand; break;
+                case opcode::fail:          success = false; ++pc;                        break;
+            }
+        }
+        return program.size();
+    }
+
+    /**
+     * Assigns the memo slots to the fields tested more than once on a single path
+     * through the program, e.g. to field_a in
+     * '(field_a 1 and field_b 2) or (field_a 3 and field_b 4)', so the interpreter
+     * fetches the value of such field at most once per run. Fields whose tests
+     * exclude each other never fetch their values twice, so they get no slot and
+     * do not pay for storing the values. If there are more such fields than the
+     * slots, the fields with the most tests get the slots, while the others are
+     * fetched by each of their tests.
+     */
+    inline void memoize( program & program )
+    {
+        std::vector< std::uint32_t > tests;
+
+        for ( auto const & instruction : program )
+        {
+            if ( instruction.code != opcode::test ) { continue; }
+
+            if ( instruction.operand >= std::size( tests ) )
+            {
+                tests.resize( instruction.operand + 1u, 0u );
+            }
+            ++tests[ instruction.operand ];
+        }
+
+        std::vector< std::uint32_t > candidates;
+        for ( std::uint32_t field{ 0u }; field < std::size( tests ); ++field )
+        {
+            if ( tests[ field ] > 1u ) { candidates.push_back( field ); }
+        }
+
+        std::vector< std::uint32_t > repeated;
+
+        if ( !candidates.empty() )
+        {
+            std::vector< std::uint32_t > on_true ( program.size() );
+            std::vector< std::uint32_t > on_false( program.size() );
+
+            for ( std::uint32_t pc{ 0u }; pc < program.size(); ++pc )
+            {
+                if ( program[ pc ].code != opcode::test ) { continue; }
+
+                on_true [ pc ] = next_test( program, pc + 1u, true  );
+                on_false[ pc ] = next_test( program, pc + 1u, false );
+            }
+
+            // Jumps only target forward, so the fields tested after each test are
+            // known by the time the test is visited backwards. Candidates are
+            // processed in batches of 64 fields, one bit per field.
+            std::vector< std::uint64_t > bits ( std::size( tests ) );
+            std::vector< std::uint64_t > after( program.size() + 1u );
+
+            for ( std::size_t batch{ 0u }; batch < std::size( candidates ); batch += 64u )
+            {
+                auto const last{ std::min( batch + 64u, std::size( candidates ) ) };
+
+                std::fill( std::begin( bits ), std::end( bits ), 0u );
+                for ( auto i{ batch }; i < last; ++i )
+                {
+                    bits[ candidates[ i ] ] = std::uint64_t{ 1u } << ( i - batch );
+                }
+
+                std::uint64_t twice{ 0u };
+
+                for ( auto pc{ program.size() }; pc-- > 0u; )
+                {
+                    if ( program[ pc ].code != opcode::test ) { continue; }
+
+                    auto const reached
+                    {
+                        [ & ]( std::uint32_t const next ) noexcept
+                        {
+                            return next < program.size()
+                                ? bits[ program[ next ].operand ] | after[ next ]
+                                : std::uint64_t{ 0u };
+                        }
+                    };
+
+                    after[ pc ] = reached( on_true[ pc ] ) | reached( on_false[ pc ] );
+                    twice      |= after[ pc ] & bits[ program[ pc ].operand ];
+                }
+
+                for ( auto i{ batch }; i < last; ++i )
+                {
+                    if ( twice & ( std::uint64_t{ 1u } << ( i - batch ) ) )
+                    {
+                        repeated.push_back( candidates[ i ] );
+                    }
+                }
+            }
+
+            std::stable_sort
+            (
+                std::begin( repeated ),
+                std::end  ( repeated ),
+                [ & ]( std::uint32_t const lhs, std::uint32_t const rhs ) noexcept
+                {
+                    return tests[ lhs ] > tests[ rhs ];
+                }
+            );
+        }
+
+        std::vector< std::uint8_t > slots( std::size( tests ), instruction::no_slot );
+
+        for ( std::size_t i{ 0u }; i < std::size( repeated ) && i < instruction::memo_slots; ++i )
+        {
+            slots[ repeated[ i ] ] = static_cast< std::uint8_t >( i );
+        }
+
+        for ( std::uint32_t pc{ 0u }; pc < program.size(); ++pc )
+        {
+            if ( program[ pc ].code == opcode::test )
+            {
+                program[ pc ].slot = slots[ program[ pc ].operand ];
+            }
+        }
+    }
+
+} // namespace internal
+
+/**
+ * Compiles the expression tree into a linear bytecode program consisting
+ * of relational tests and conditional jumps implementing short-circuiting.
+ *
+ * @param arena   Arena containing the expression tree
+ * @param program Program to compile the expression tree into, reusing its storage
+ *
+ * @return True if the expression tree is successfully compiled, otherwise false
+ */
+inline bool compile( tree::arena const & arena, program & program )
+{
+    program.clear();
+
+    if ( arena.empty() ) { return false; }
+
+    internal::compile_node( arena, arena.root(), program );
+    internal::thread_jumps( program );
+    internal::memoize     ( program );
+
+    return true;
+}
+
+} // namespace booleval::bytecode
+
+#endif // BOOLEVAL_COMPILER_HPP
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef BOOLEVAL_INSTRUCTION_HPP
+#define BOOLEVAL_INSTRUCTION_HPP
+
+#include <cstdint>
+
+#include <booleval/token/token_type.hpp>
+
+namespace booleval::bytecode
+{
+
+/**
+ * enum class opcode
+ *
+ * Represents an operation code of the bytecode instruction.
+ */
+enum class [[ nodiscard ]] opcode : std::uint8_t
+{
+    // Evaluates relational operation and stores its outcome into the result register
+    test,
+
+    // Jumps to the target instruction if the result register is true
+    jump_if_true,
+
+    // Jumps to the target instruction if the result register is false
+    jump_if_false,
+
+    // Stores false and the error message into the result register
+    fail
+};
+
+/**
+ * struct instruction
+ *
+ * Represents a single instruction of the bytecode program. Meaning of the
+ * operands depends on the operation code:
+ *
+ * - test:          operand is the field index and literal is the literal index
+ *                  or the set index in case of 'in' and 'not in' relations, while
+ *                  slot is the index of the memoized value of the field, if any
+ * - jump_if_true:  operand is the index of the target instruction
+ * - jump_if_false: operand is the index of the target instruction
+ * - fail:          operand is the message index
+ */
+struct instruction
+{
+    /**
+     * Maximum number of the memoized field values per program.
+     */
+    static constexpr std::uint8_t memo_slots{ 8u };
+
+    /**
+     * Slot of the test whose field value is not memoized.
+     */
+    static constexpr std::uint8_t no_slot{ 0xFFu };
+
+    opcode            code    { opcode::fail               };
+    token::token_type relation{ token::token_type::unknown };
+    std::uint8_t      slot    { no_slot                    };
+    std::uint32_t     operand { 0u                         };
+    std::uint32_t     literal { 0u                         };
+};
+
+} // namespace booleval::bytecode
+
+#endif // BOOLEVAL_INSTRUCTION_HPP
@@ -0,0 +1,482 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef BOOLEVAL_INTERPRETER_HPP
+#define BOOLEVAL_INTERPRETER_HPP
+
+#include <new>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <type_traits>
+#include <algorithm>
+#include <functional>
+#include <string_view>
+
+#include <booleval/field.hpp>
+#include <booleval/result.hpp>
+#include <booleval/typed_field.hpp>
+#include <booleval/utils/bitmap.hpp>
+#include <booleval/utils/any_value.hpp>
+#include <booleval/token/token_type.hpp>
+#include <booleval/bytecode/batch.hpp>
+#include <booleval/bytecode/program.hpp>
+#include <booleval/bytecode/instruction.hpp>
+
+namespace booleval::bytecode
+{
+
+namespace internal
+{
+
+    template< typename F >
+    [[ nodiscard ]] F const & deref( F const & field ) noexcept { return field; }
+
+    template< typename F >
+    [[ nodiscard ]] F const & deref( std::unique_ptr< F > const & field ) noexcept { return *field; }
+
+    /**
+     * @class memo
+     *
+     * Represents the values of the fields memoized during one run of the program.
+     * Slots are left uninitialized until their values are fetched, so the runs of the
+     * programs without any memoized field do not pay for them.
+     */
+    class memo
+    {
+    public:
+        memo() noexcept = default;
+
+        memo( memo       && rhs ) = delete;
+        memo( memo const  & rhs ) = delete;
+
+        memo & operator=( memo       && rhs ) = delete;
+        memo & operator=( memo const  & rhs ) = delete;
+
+        ~memo() noexcept
+        {
+            for ( auto engaged{ engaged_ }; engaged != 0u; engaged &= static_cast< std::uint8_t >( engaged - 1u ) )
+            {
+                at( utils::lowest_bit( engaged ) ).~any_value();
+            }
+        }
+
+        /**
+         * Gets the value of the slot, fetching it first if this is the first time the slot is used.
+         *
+         * @param slot  Slot index
+         * @param fetch Function fetching the value
+         *
+         * @return Value of the slot
+         */
+        template< typename F >
+        [[ nodiscard ]] utils::any_value const & get( std::uint8_t const slot, F && fetch ) noexcept
+        {
+            auto const bit{ static_cast< std::uint8_t >( 1u << slot ) };
+
+            if ( ( engaged_ & bit ) == 0u )
+            {
+                ::new ( static_cast< void * >( &storage_[ slot ] ) ) utils::any_value{ fetch() };
+                engaged_ |= bit;
+            }
+
+            return at( slot );
+        }
+
+    private:
+        [[ nodiscard ]] utils::any_value & at( std::size_t const slot ) noexcept
+        {
+            return *std::launder( reinterpret_cast< utils::any_value * >( &storage_[ slot ] ) );
+        }
+
+    private:
+        std::aligned_storage_t< sizeof( utils::any_value ), alignof( utils::any_value ) > storage_[ instruction::memo_slots ];
+        std::uint8_t                                                                        engaged_{ 0u };
+    };
+
+} // namespace internal
+
+/**
+ * @class basic_interpreter
+ *
+ * Represents an interpreter of the bytecode programs. It runs the program
+ * instruction by instruction in a single loop, without any recursion, in
+ * order to get the final result of the expression based on the fields of
+ * an object being passed.
+ *
+ * The field table is made of the Field elements, each of them (or the object
+ * they point to) having the name and invoke member function. Fields are passed
+ * in as Input elements which the Field elements are constructed from.
+ */
+template< typename Field, typename Input = Field >
+class basic_interpreter
+{
+public:
+    using input_type = Input;
+
+    /**
+     * Sets the fields used for evaluation of bytecode programs.
+     * Programs need to be bound again after the fields are changed.
+     *
+     * @param fields Fields to be used in evaluation process
+     */
+    void fields( std::initializer_list< Input > fields ) noexcept
+    {
+        fields_ = std::vector< Field >( std::begin( fields ), std::end( fields ) );
+    }
+
+    /**
+     * Binds the field names the program refers to to the fields of this interpreter.
+     *
+     * @param program Program to bind
+     *
+     * @return True if all the fields are known, otherwise false
+     */
+    bool bind( program & program ) const
+    {
+        return program.bind
+        (
+            [ this ]( std::string_view const name ) noexcept
+            {
+                auto const it
+                {
+                    std::find_if
+                    (
+                        std::cbegin( fields_ ),
+                        std::cend  ( fields_ ),
+                        [ name ]( auto && field ) noexcept
+                        {
+                            return internal::deref( field ).name == name;
+                        }
+                    )
+                };
+
+                if ( it == std::cend( fields_ ) ) { return program::unbound; }
+
+                return static_cast< std::uint32_t >( std::distance( std::cbegin( fields_ ), it ) );
+            }
+        );
+    }
+
+    /**
+     * Runs the bound bytecode program for the object passed in.
+     * Program is not run until the values of all of its parameters are bound.
+     *
+     * @param program Program to run
+     * @param obj     Object to be evaluated
+     *
+     * @return Result
+     */
+    template< typename T >
+    [[ nodiscard ]] result run( program const & program, T && obj ) const noexcept
+    {
+        if ( !program.ready() )
+        {
+            return { false, "Unbound parameter" };
+        }
+
+        result result{};
+
+        // values of the fields tested more than once, fetched when they are needed for the first time
+        internal::memo values{};
+
+        for ( std::uint32_t pc{ 0u }; pc < program.size(); )
+        {
+            auto const & instruction{ program[ pc ] };
+
+            switch ( instruction.code )
+            {
+                case opcode::test:
+                    test( program, instruction, values, result, std::forward< T >( obj ) );
+                    ++pc;
+                    break;
+
+                case opcode::jump_if_true:
+                    pc = result.success ? instruction.operand : pc + 1;
+                    break;
+
+                case opcode::jump_if_false:
+                    pc = result.success ? pc + 1 : instruction.operand;
+                    break;
+
+                case opcode::fail:
+                    fail( result, program.message( instruction.operand ) );
+                    ++pc;
+                    break;
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * Runs the bound bytecode program for the batch of objects, one instruction across the
+     * whole batch at a time. Tests skip the words of 64 objects none of which reaches them.
+     *
+     * @param program   Program to run
+     * @param objects   Pointer to the first object of the batch
+     * @param size      Number of the objects
+     * @param selection Bitmap to set the bits of the objects satisfying the program in
+     *
+     * @return True if the program is run, false if any of its parameters is not bound
+     */
+    template< typename T >
+    bool run( program const & program, T const * const objects, std::size_t const size, utils::bitmap & selection ) const
+    {
+        return run_batch
+        (
+            program,
+            size,
+            selection,
+            [ this, &program, objects ]
+            (
+                instruction   const & instruction,
+                std::size_t   const   first,
+                std::size_t   const   rows,
+                std::uint64_t const * active,
+                std::uint64_t       * result
+            ) noexcept
+            {
+                auto const words{ ( rows + utils::bitmap::word_bits - 1u ) / utils::bitmap::word_bits };
+                test( program, instruction, objects + first, active, result, words );
+            }
+        );
+    }
+
+private:
+    /**
+     * Stores false and the error message into the result. Error message closer
+     * to the beginning of the expression is kept.
+     *
+     * @param result  Result register
+     * @param message Error message
+     */
+    static void fail( result & result, std::string_view const message ) noexcept
+    {
+        result.success = false;
+        if ( result.message.empty() )
+        {
+            result.message = message;
+        }
+    }
+
+    /**
+     * Evaluates the relational operation and stores its outcome into the result.
+     * Value of the memoized field is fetched only by the first test of that field.
+     *
+     * @param program     Program being run
+     * @param instruction Test instruction
+     * @param values      Memoized field values
+     * @param result      Result register
+     * @param obj         Object to be evaluated
+     */
+    template< typename T >
+    void test( program const & program, instruction const & instruction, internal::memo & values, result & result, T && obj ) const noexcept
+    {
+        auto const index{ program.binding( instruction.operand ) };
+
+        if ( index >= std::size( fields_ ) )
+        {
+            fail( result, "Unknown field" );
+            return;
+        }
+
+        auto const & field{ internal::deref( fields_[ index ] ) };
+
+        if ( instruction.slot == instruction::no_slot )
+        {
+            compare( program, instruction, field.invoke( std::forward< T >( obj ) ), result );
+            return;
+        }
+
+        auto const & value
+        {
+            values.get
+            (
+                instruction.slot,
+                [ &field, &obj ]() noexcept
+                {
+                    return field.invoke( std::forward< T >( obj ) );
+                }
+            )
+        };
+
+        compare( program, instruction, value, result );
+    }
+
+    /**
+     * Compares the field value as the test instruction specifies and stores the outcome into the result.
+     *
+     * @param program     Program being run
+     * @param instruction Test instruction
+     * @param value       Field value
+     * @param result      Result register
+     */
+    static void compare( program const & program, instruction const & instruction, utils::any_value const & value, result & result ) noexcept
+    {
+        switch ( instruction.relation )
+        {
+            case token::token_type::in    : result.success =  program.set( instruction.literal ).contains( value ); return;
+            case token::token_type::not_in: result.success =  program.set( instruction.literal ).excludes( value ); return;
+
+            default:
+                break;
+        }
+
+        auto const & literal{ program.literal( instruction.literal ) };
+
+        switch ( instruction.relation )
+        {
+            case token::token_type::eq : result.success = value == literal; break;
+            case token::token_type::neq: result.success = value != literal; break;
+            case token::token_type::gt : result.success = value >  literal; break;
+            case token::token_type::lt : result.success = value <  literal; break;
+            case token::token_type::geq: result.success = value >= literal; break;
+            case token::token_type::leq: result.success = value <= literal; break;
+
+            default:
+                fail( result, "Unknown token type" );
+                break;
+        }
+    }
+
+    /**
+     * Evaluates the relational operation for the objects of the batch reaching the test
+     * and stores its outcome into their bits of the result. Relation is dispatched once
+     * for the whole batch rather than once per object.
+     *
+     * @param program     Program being run
+     * @param instruction Test instruction
+     * @param objects     Pointer to the first object of the chunk
+     * @param active      Masks of the objects reaching the test
+     * @param result      Result registers of the objects
+     * @param words       Number of the masks
+     */
+    template< typename T >
+    void test
+    (
+        program       const & program,
+        instruction   const & instruction,
+        T             const * objects,
+        std::uint64_t const * active,
+        std::uint64_t       * result,
+        std::size_t   const   words
+    ) const noexcept
+    {
+        auto const index{ program.binding( instruction.operand ) };
+
+        if ( index >= std::size( fields_ ) )
+        {
+            for ( std::size_t w{ 0u }; w < words; ++w ) { result[ w ] &= ~active[ w ]; }
+            return;
+        }
+
+        auto const & field{ internal::deref( fields_[ index ] ) };
+
+        auto const select
+        {
+            [ & ]( auto && predicate ) noexcept
+            {
+                for ( std::size_t w{ 0u }; w < words; ++w )
+                {
+                    auto const mask{ active[ w ] };
+                    if ( mask == 0u ) { continue; }
+
+                    auto const * const chunk{ objects + w * utils::bitmap::word_bits };
+
+                    std::uint64_t selected{ 0u };
+                    for ( auto m{ mask }; m != 0u; m &= m - 1u )
+                    {
+                        auto const bit{ utils::lowest_bit( m ) };
+                        if ( predicate( field.invoke( chunk[ bit ] ) ) )
+                        {
+                            selected |= std::uint64_t{ 1u } << bit;
+                        }
+                    }
+
+                    result[ w ] = ( result[ w ] & ~mask ) | selected;
+                }
+            }
+        };
+
+        switch ( instruction.relation )
+        {
+            case token::token_type::in:
+            {
+                auto const & set{ program.set( instruction.literal ) };
+                select( [ &set ]( auto const & value ) noexcept { return set.contains( value ); } );
+                return;
+            }
+
+            case token::token_type::not_in:
+            {
+                auto const & set{ program.set( instruction.literal ) };
+                select( [ &set ]( auto const & value ) noexcept { return set.excludes( value ); } );
+                return;
+            }
+
+            default:
+                break;
+        }
+
+        auto const & literal{ program.literal( instruction.literal ) };
+
+        switch ( instruction.relation )
+        {
+            case token::token_type::eq : select( [ &literal ]( auto const & value ) noexcept { return value == literal; } ); break;
+            case token::token_type::neq: select( [ &literal ]( auto const & value ) noexcept { return value != literal; } ); break;
+            case token::token_type::gt : select( [ &literal ]( auto const & value ) noexcept { return value >  literal; } ); break;
+            case token::token_type::lt : select( [ &literal ]( auto const & value ) noexcept { return value <  literal; } ); break;
+            case token::token_type::geq: select( [ &literal ]( auto const & value ) noexcept { return value >= literal; } ); break;
+            case token::token_type::leq: select( [ &literal ]( auto const & value ) noexcept { return value <= literal; } ); break;
+
+            default:
+                for ( std::size_t w{ 0u }; w < words; ++w ) { result[ w ] &= ~active[ w ]; }
+                break;
+        }
+    }
+
+private:
+    std::vector< Field > fields_;
+};
+
+/**
+ * Interpreter of the fields of any class, found by RTTI on every invocation.
+ */
+using interpreter = basic_interpreter< std::unique_ptr< field_base >, field_base * >;
+
+/**
+ * Interpreter of the fields of the class known at compile time.
+ */
+template< typename C >
+using typed_interpreter = basic_interpreter< typed_field< C > >;
+
+} // namespace booleval::bytecode
+
+#endif // BOOLEVAL_INTERPRETER_HPP
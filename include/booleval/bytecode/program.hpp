@@ -0,0 +1,424 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef BOOLEVAL_PROGRAM_HPP
+#define BOOLEVAL_PROGRAM_HPP
+
+#include <limits>
+#include <locale>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <iomanip>
+#include <sstream>
+#include <charconv>
+#include <algorithm>
+#include <string_view>
+#include <type_traits>
+
+#include <booleval/utils/constant.hpp>
+#include <booleval/utils/constant_set.hpp>
+#include <booleval/bytecode/instruction.hpp>
+
+namespace booleval::bytecode
+{
+
+/**
+ * @class program
+ *
+ * Represents a linear sequence of bytecode instructions together with the
+ * field names, literals and messages the instructions are referring to.
+ * Field names are views into the text of the compiled expression, while literals
+ * are stored as constants (or sets of constants) that are converted only once, when
+ * the program is compiled.
+ *
+ * Before the program is run, field names need to be bound to the indices of
+ * the fields within the field table so the fields are not looked up by name
+ * on every evaluation.
+ *
+ * Parameters of the expression are compiled into the placeholder literals (or sets)
+ * whose values are bound later, any number of times, without compiling the program
+ * again. Program owns the text of the bound values, so they do not need to outlive it.
+ *
+ * Since the literals are the views into the text of the expression and of the bound
+ * values, the copy of the program would keep referring to the text of the original one.
+ * Therefore, program is not copyable, while it can be moved along with its expression tree.
+ */
+class program
+{
+public:
+    using const_iterator = std::vector< instruction >::const_iterator;
+
+    program() = default;
+
+    program( program       && rhs ) = default;
+    program( program const  & rhs ) = delete;
+
+    program & operator=( program       && rhs ) = default;
+    program & operator=( program const  & rhs ) = delete;
+
+    ~program() = default;
+
+    /**
+     * Index of the field that is not bound to any field of the field table.
+     */
+    static constexpr std::uint32_t unbound{ std::numeric_limits< std::uint32_t >::max() };
+
+    /**
+     * Removes all the instructions while keeping the allocated storage.
+     */
+    void clear() noexcept
+    {
+        instructions_.clear();
+        fields_      .clear();
+        bindings_    .clear();
+        literals_    .clear();
+        sets_        .clear();
+        messages_    .clear();
+        parameters_  .clear();
+        unbound_ = 0u;
+    }
+
+    /**
+     * Appends the instruction to the end of the program.
+     *
+     * @param instruction Instruction to append
+     *
+     * @return Index of the appended instruction
+     */
+    std::uint32_t emit( instruction const instruction )
+    {
+        instructions_.push_back( instruction );
+        return static_cast< std::uint32_t >( std::size( instructions_ ) - 1 );
+    }
+
+    /**
+     * Gets the index of the field name, adding it if the program does not refer to it yet.
+     *
+     * @param name Field name
+     *
+     * @return Field index
+     */
+    std::uint32_t field( std::string_view const name )
+    {
+        auto const index{ index_of( fields_, name ) };
+        bindings_.resize( std::size( fields_ ), unbound );
+        return index;
+    }
+
+    /**
+     * Binds all the field names the program refers to. Field names that cannot
+     * be resolved stay unbound.
+     *
+     * @param lookup Function mapping the field name to the index of the field
+     *               within the field table or to unbound if there is no such field
+     *
+     * @return True if all the field names are bound, otherwise false
+     */
+    template< typename F >
+    bool bind( F && lookup )
+    {
+        auto success{ true };
+
+        for ( std::size_t i{ 0u }; i < std::size( fields_ ); ++i )
+        {
+            bindings_[ i ] = lookup( fields_[ i ] );
+            success = success && bindings_[ i ] != unbound;
+        }
+
+        return success;
+    }
+
+    /**
+     * Appends the literal the instructions can refer to.
+     *
+     * @param value Literal value
+     *
+     * @return Literal index
+     */
+    std::uint32_t literal( std::string_view const value )
+    {
+        literals_.emplace_back( value );
+        return static_cast< std::uint32_t >( std::size( literals_ ) - 1 );
+    }
+
+    /**
+     * Appends the set of literals the instructions can refer to.
+     *
+     * @param set Set of literals
+     *
+     * @return Set index
+     */
+    std::uint32_t set( utils::constant_set set )
+    {
+        sets_.push_back( std::move( set ) );
+        return static_cast< std::uint32_t >( std::size( sets_ ) - 1 );
+    }
+
+    /**
+     * Appends the placeholder literal, or the placeholder set, whose value is bound later
+     * as the parameter with the specified number.
+     *
+     * @param number Parameter number
+     * @param is_set True if the parameter is the set of values, otherwise false
+     *
+     * @return Literal index or set index
+     */
+    std::uint32_t placeholder( std::uint32_t const number, bool const is_set )
+    {
+        if ( number >= std::size( parameters_ ) )
+        {
+            unbound_ += number + 1u - static_cast< std::uint32_t >( std::size( parameters_ ) );
+            parameters_.resize( number + 1u );
+        }
+
+        auto & parameter{ parameters_[ number ] };
+        parameter.is_set = is_set;
+        parameter.index  = is_set ? set( utils::constant_set{} ) : literal( std::string_view{} );
+
+        return parameter.index;
+    }
+
+    /**
+     * Binds the value of the parameter.
+     *
+     * @param number Parameter number
+     * @param value  Value of the parameter, either string or arithmetic value
+     *
+     * @return True if the parameter exists and it is not a set, otherwise false
+     */
+    template< typename T >
+    bool parameter( std::uint32_t const number, T const & value )
+    {
+        if ( number >= std::size( parameters_ ) || parameters_[ number ].is_set ) { return false; }
+
+        auto & parameter{ parameters_[ number ] };
+
+        parameter.text.clear();
+        append( parameter.text, value );
+
+        literals_[ parameter.index ] = utils::constant{ parameter.text };
+        mark_bound( parameter );
+
+        return true;
+    }
+
+    /**
+     * Binds the values of the set parameter.
+     *
+     * @param number Parameter number
+     * @param first  Iterator to the first value, either string or arithmetic value
+     * @param last   Iterator past the last value
+     *
+     * @return True if the parameter exists and it is a set, otherwise false
+     */
+    template< typename InputIt >
+    bool parameter( std::uint32_t const number, InputIt first, InputIt const last )
+    {
+        if ( number >= std::size( parameters_ ) || !parameters_[ number ].is_set ) { return false; }
+
+        auto & parameter{ parameters_[ number ] };
+
+        // values are appended one after another first, so the text does not reallocate
+        // once the constants are referring to it
+        parameter.text   .clear();
+        parameter.lengths.clear();
+
+        for ( ; first != last; ++first )
+        {
+            auto const size{ std::size( parameter.text ) };
+            append( parameter.text, *first );
+            parameter.lengths.push_back( std::size( parameter.text ) - size );
+        }
+
+        parameter.constants.clear();
+
+        std::string_view rest{ parameter.text };
+        for ( auto const length : parameter.lengths )
+        {
+            parameter.constants.emplace_back( rest.substr( 0, length ) );
+            rest.remove_prefix( length );
+        }
+
+        sets_[ parameter.index ].assign( std::cbegin( parameter.constants ), std::cend( parameter.constants ) );
+        mark_bound( parameter );
+
+        return true;
+    }
+
+    /**
+     * Gets the number of the parameters the program has.
+     *
+     * @return Number of the parameters
+     */
+    [[ nodiscard ]] std::uint32_t parameters() const noexcept
+    {
+        return static_cast< std::uint32_t >( std::size( parameters_ ) );
+    }
+
+    /**
+     * Checks whether the values of all the parameters are bound.
+     *
+     * @return True if all the parameters are bound, otherwise false
+     */
+    [[ nodiscard ]] bool ready() const noexcept
+    {
+        return unbound_ == 0u;
+    }
+
+    /**
+     * Gets the index of the message, adding it if the program does not refer to it yet.
+     *
+     * @param message Message
+     *
+     * @return Message index
+     */
+    std::uint32_t message( std::string_view const message )
+    {
+        return index_of( messages_, message );
+    }
+
+    [[ nodiscard ]] instruction const & operator[]( std::uint32_t const index ) const noexcept { return instructions_[ index ]; }
+    [[ nodiscard ]] instruction       & operator[]( std::uint32_t const index )       noexcept { return instructions_[ index ]; }
+
+    [[ nodiscard ]] std::string_view            field  ( std::uint32_t const index ) const noexcept { return fields_  [ index ]; }
+    [[ nodiscard ]] std::uint32_t               binding( std::uint32_t const index ) const noexcept { return bindings_[ index ]; }
+    [[ nodiscard ]] utils::constant     const & literal( std::uint32_t const index ) const noexcept { return literals_[ index ]; }
+    [[ nodiscard ]] utils::constant_set const & set    ( std::uint32_t const index ) const noexcept { return sets_    [ index ]; }
+    [[ nodiscard ]] std::string_view            message( std::uint32_t const index ) const noexcept { return messages_[ index ]; }
+
+    [[ nodiscard ]] std::uint32_t size() const noexcept { return static_cast< std::uint32_t >( std::size( instructions_ ) ); }
+    [[ nodiscard ]] bool         empty() const noexcept { return instructions_.empty(); }
+
+    [[ nodiscard ]] const_iterator begin() const noexcept { return std::cbegin( instructions_ ); }
+    [[ nodiscard ]] const_iterator end  () const noexcept { return std::cend  ( instructions_ ); }
+
+private:
+    /**
+     * @struct parameter_slot
+     *
+     * Represents the storage of the parameter value bound into the placeholder literal or set.
+     */
+    struct parameter_slot
+    {
+        std::string                    text     {};
+        std::vector< std::size_t     > lengths  {};
+        std::vector< utils::constant > constants{};
+        std::uint32_t                  index    { 0u    };
+        bool                           is_set   { false };
+        bool                           bound    { false };
+    };
+
+    void mark_bound( parameter_slot & parameter ) noexcept
+    {
+        if ( !parameter.bound )
+        {
+            parameter.bound = true;
+            --unbound_;
+        }
+    }
+
+    /**
+     * Appends the text of the value. Booleans are written as 1 and 0, the same way they are
+     * compared, while floating point values are written with enough digits to be read back exactly,
+     * in their own precision and always with the decimal point, regardless of the current locale.
+     */
+    template< typename T >
+    static void append( std::string & text, T const & value )
+    {
+        if constexpr ( std::is_convertible_v< T const &, std::string_view > )
+        {
+            text.append( std::string_view{ value } );
+        }
+        else if constexpr ( std::is_same_v< T, bool > )
+        {
+            text.push_back( value ? '1' : '0' );
+        }
+        else if constexpr ( std::is_integral_v< T > )
+        {
+            char buffer[ std::numeric_limits< T >::digits10 + 3 ];
+            auto const result{ std::to_chars( std::begin( buffer ), std::end( buffer ), value ) };
+            text.append( std::begin( buffer ), result.ptr );
+        }
+        else
+        {
+            static_assert( std::is_floating_point_v< T >, "Parameter value must be either string or arithmetic value." );
+
+#if defined( __cpp_lib_to_chars )
+            char buffer[ 64 ];
+            auto const result
+            {
+                std::to_chars
+                (
+                    std::begin( buffer ),
+                    std::end  ( buffer ),
+                    value,
+                    std::chars_format::general,
+                    std::numeric_limits< T >::max_digits10
+                )
+            };
+            text.append( std::begin( buffer ), result.ptr );
+#else
+            // stream with the classic locale is the fallback that still does not depend on
+            // the decimal separator of the current locale
+            std::ostringstream stream;
+            stream.imbue( std::locale::classic() );
+            stream << std::setprecision( std::numeric_limits< T >::max_digits10 ) << value;
+            text.append( stream.str() );
+#endif
+        }
+    }
+
+    static std::uint32_t index_of( std::vector< std::string_view > & values, std::string_view const value )
+    {
+        auto const it{ std::find( std::cbegin( values ), std::cend( values ), value ) };
+        if ( it != std::cend( values ) )
+        {
+            return static_cast< std::uint32_t >( std::distance( std::cbegin( values ), it ) );
+        }
+
+        values.push_back( value );
+        return static_cast< std::uint32_t >( std::size( values ) - 1 );
+    }
+
+private:
+    std::vector< instruction         > instructions_{};
+    std::vector< std::string_view    > fields_      {};
+    std::vector< std::uint32_t       > bindings_    {};
+    std::vector< utils::constant     > literals_    {};
+    std::vector< utils::constant_set > sets_        {};
+    std::vector< std::string_view    > messages_    {};
+    std::vector< parameter_slot      > parameters_  {};
+    std::uint32_t                      unbound_     { 0u };
+};
+
+} // namespace booleval::bytecode
+
+#endif // BOOLEVAL_PROGRAM_HPP
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef BOOLEVAL_COLUMN_HPP
+#define BOOLEVAL_COLUMN_HPP
+
+#include <vector>
+#include <cstdint>
+#include <string_view>
+#include <initializer_list>
+
+namespace booleval::columnar
+{
+
+/**
+ * enum class column_type
+ *
+ * Represents the type of the values stored in the column.
+ */
+enum class [[ nodiscard ]] column_type : std::uint8_t
+{
+    int32,
+    int64,
+    float64,
+    string
+};
+
+/**
+ * @struct field
+ *
+ * Represents the field of the columnar evaluator, i.e. the name the expression refers
+ * to the column by and the type of the values stored in that column.
+ */
+struct field
+{
+    std::string_view name{};
+    column_type      type{ column_type::int32 };
+};
+
+/**
+ * @class column
+ *
+ * Represents the view of the contiguous values of one field across the batch of rows.
+ * Numeric values are stored as a plain array. Strings are stored back to back in one
+ * array of bytes, while the offsets array holds the offset of each of them followed
+ * by the offset past the last one, i.e. string i spans [offsets[i], offsets[i + 1]).
+ * Column does not own its values.
+ */
+class column
+{
+public:
+    constexpr column() noexcept = default;
+
+    constexpr column( std::int32_t  const * values ) noexcept : type_{ column_type::int32   }, values_{ values } {}
+    constexpr column( std::int64_t  const * values ) noexcept : type_{ column_type::int64   }, values_{ values } {}
+    constexpr column( double        const * values ) noexcept : type_{ column_type::float64 }, values_{ values } {}
+
+    constexpr column( std::uint32_t const * offsets, char const * bytes ) noexcept
+        : type_   { column_type::string }
+        , offsets_{ offsets             }
+        , bytes_  { bytes               }
+    {}
+
+    [[ nodiscard ]] constexpr column_type type() const noexcept { return type_; }
+
+    /**
+     * Gets the array of the numeric values.
+     *
+     * @return Pointer to the first value
+     */
+    template< typename T >
+    [[ nodiscard ]] T const * values() const noexcept
+    {
+        return static_cast< T const * >( values_ );
+    }
+
+    /**
+     * Gets the string value of the row.
+     *
+     * @param row Row index
+     *
+     * @return String value
+     */
+    [[ nodiscard ]] std::string_view string( std::size_t const row ) const noexcept
+    {
+        return { bytes_ + offsets_[ row ], static_cast< std::size_t >( offsets_[ row + 1u ] - offsets_[ row ] ) };
+    }
+
+private:
+    column_type           type_   { column_type::int32 };
+    void          const * values_ { nullptr };
+    std::uint32_t const * offsets_{ nullptr };
+    char          const * bytes_  { nullptr };
+};
+
+/**
+ * @class batch
+ *
+ * Represents the batch of rows stored column by column. Columns are given
+ * in the same order as the fields of the columnar evaluator.
+ */
+class batch
+{
+public:
+    batch() = default;
+
+    batch( std::size_t const size, std::initializer_list< column > columns )
+        : size_   { size                                        }
+        , columns_{ std::begin( columns ), std::end( columns ) }
+    {}
+
+    /**
+     * Sets the number of the rows, e.g. when the batch is refilled with the next rows
+     * without allocating its columns again.
+     *
+     * @param size Number of the rows
+     */
+    void size( std::size_t const size ) noexcept
+    {
+        size_ = size;
+    }
+
+    [[ nodiscard ]] std::size_t size() const noexcept { return size_; }
+
+    [[ nodiscard ]] std::vector< column > const & columns() const noexcept { return columns_; }
+    [[ nodiscard ]] std::vector< column >       & columns()       noexcept { return columns_; }
+
+private:
+    std::size_t           size_   { 0u };
+    std::vector< column > columns_{};
+};
+
+} // namespace booleval::columnar
+
+#endif // BOOLEVAL_COLUMN_HPP
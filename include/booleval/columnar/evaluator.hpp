@@ -0,0 +1,448 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef BOOLEVAL_COLUMNAR_EVALUATOR_HPP
+#define BOOLEVAL_COLUMNAR_EVALUATOR_HPP
+
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <string_view>
+#include <initializer_list>
+
+#include <booleval/compiled_expression.hpp>
+#include <booleval/tree/arena.hpp>
+#include <booleval/utils/bitmap.hpp>
+#include <booleval/utils/constant.hpp>
+#include <booleval/utils/any_value.hpp>
+#include <booleval/token/token_type.hpp>
+#include <booleval/bytecode/batch.hpp>
+#include <booleval/bytecode/program.hpp>
+#include <booleval/bytecode/instruction.hpp>
+#include <booleval/columnar/column.hpp>
+#include <booleval/columnar/kernels.hpp>
+
+namespace booleval::columnar
+{
+
+/**
+ * @class evaluator
+ *
+ * Represents a class for evaluating logical expressions over the batches of rows stored
+ * column by column. Expression is compiled the same way as by the evaluator of objects,
+ * while each of its tests is run across the whole batch. Comparison of the numeric column
+ * with the numeric constant is run by the SIMD kernel of the best instruction set supported
+ * by the CPU, falling back to the scalar kernel. Strings, set membership and the comparisons
+ * of the integer columns with the floating point constants are evaluated row by row, giving
+ * the same results as the evaluator of objects.
+ *
+ * Evaluator can be moved, since the compiled program and the expression tree whose text
+ * it refers to are moved together, but it cannot be copied.
+ */
+class evaluator
+{
+public:
+    evaluator() = default;
+
+    evaluator( evaluator       && rhs ) = default;
+    evaluator( evaluator const  & rhs ) = delete;
+
+    evaluator & operator=( evaluator       && rhs ) = default;
+    evaluator & operator=( evaluator const  & rhs ) = delete;
+
+    ~evaluator() = default;
+
+    evaluator( std::initializer_list< field > fields )
+        : fields_{ std::begin( fields ), std::end( fields ) }
+    {}
+
+    /**
+     * Sets the fields, i.e. the names and the types of the columns of the batches.
+     * Field names of the current expression are bound to the new fields.
+     *
+     * @param fields Fields to be used in evaluation process
+     */
+    void fields( std::initializer_list< field > fields )
+    {
+        fields_.assign( std::begin( fields ), std::end( fields ) );
+
+        if ( !program_.empty() )
+        {
+            bind();
+        }
+    }
+
+    /**
+     * Checks whether the evaluation is activated or not, i.e.
+     * if the expression is valid and all of its fields are known.
+     *
+     * @return True if the evaluation is activated, otherwise false
+     */
+    [[ nodiscard ]] bool is_activated() const noexcept
+    {
+        return is_activated_;
+    }
+
+    /**
+     * Sets the expression to be used for evaluation.
+     *
+     * @param expression Expression to be used for evaluation
+     *
+     * @return True if the expression is valid and all of its fields are known, otherwise false
+     */
+    [[ nodiscard ]] bool expression( std::string_view const expression )
+    {
+        is_activated_ = false;
+        program_.clear();
+
+        if ( expression.empty() ) { return true; }
+
+        if ( !booleval::internal::compile( expression, parsed_, tree_, program_ ) )
+        {
+            return false;
+        }
+
+        return bind();
+    }
+
+    /**
+     * Binds the value of the parameter of the current expression.
+     *
+     * @param number Parameter number
+     * @param value  Value of the parameter, either string or arithmetic value
+     *
+     * @return True if the current expression has such parameter and it is not a set, otherwise false
+     */
+    template< typename T >
+    bool parameter( std::uint32_t const number, T const & value )
+    {
+        return program_.parameter( number, value );
+    }
+
+    /**
+     * Binds the values of the set parameter of the current expression.
+     *
+     * @param number Parameter number
+     * @param first  Iterator to the first value, either string or arithmetic value
+     * @param last   Iterator past the last value
+     *
+     * @return True if the current expression has such parameter and it is a set, otherwise false
+     */
+    template< typename InputIt >
+    bool parameter( std::uint32_t const number, InputIt const first, InputIt const last )
+    {
+        return program_.parameter( number, first, last );
+    }
+
+    /**
+     * Binds the values of the set parameter of the current expression.
+     *
+     * @param number Parameter number
+     * @param values Values of the parameter
+     *
+     * @return True if the current expression has such parameter and it is a set, otherwise false
+     */
+    template< typename T >
+    bool parameter( std::uint32_t const number, std::initializer_list< T > const values )
+    {
+        return parameter( number, std::begin( values ), std::end( values ) );
+    }
+
+    /**
+     * Sets the instruction set of the comparison kernels. Instruction set better than
+     * the supported one is not used. The best supported instruction set is used by default.
+     *
+     * @param isa Instruction set
+     */
+    void kernels( instruction_set const isa ) noexcept
+    {
+        isa_ = std::min( isa, supported_instruction_set() );
+    }
+
+    /**
+     * Gets the instruction set of the comparison kernels.
+     *
+     * @return Instruction set
+     */
+    [[ nodiscard ]] instruction_set kernels() const noexcept
+    {
+        return isa_;
+    }
+
+    /**
+     * Evaluates the expression for the batch of rows. None of the rows is selected
+     * if the evaluation is not activated or the columns do not match the fields.
+     *
+     * @param rows      Batch of rows
+     * @param selection Bitmap to set the bits of the rows satisfying the expression in
+     *
+     * @return True if the batch is evaluated, otherwise false
+     */
+    bool evaluate( batch const & rows, utils::bitmap & selection ) const
+    {
+        if ( !is_activated_ || !matches( rows ) )
+        {
+            selection.reset( rows.size() );
+            return false;
+        }
+
+        return bytecode::run_batch
+        (
+            program_,
+            rows.size(),
+            selection,
+            [ this, &rows ]
+            (
+                bytecode::instruction const & instruction,
+                std::size_t           const   first,
+                std::size_t           const   count,
+                std::uint64_t         const * active,
+                std::uint64_t               * result
+            ) noexcept
+            {
+                test( rows, instruction, first, count, active, result );
+            }
+        );
+    }
+
+    /**
+     * Evaluates the expression for the batch of rows.
+     *
+     * @param rows Batch of rows
+     *
+     * @return Bitmap of the rows satisfying the expression
+     */
+    [[ nodiscard ]] utils::bitmap evaluate( batch const & rows ) const
+    {
+        utils::bitmap selection{};
+        evaluate( rows, selection );
+        return selection;
+    }
+
+private:
+    /**
+     * Binds field names of the program to the fields.
+     *
+     * @return True if all the fields are known, otherwise false
+     */
+    bool bind()
+    {
+        is_activated_ = program_.bind
+        (
+            [ this ]( std::string_view const name ) noexcept
+            {
+                auto const it
+                {
+                    std::find_if
+                    (
+                        std::cbegin( fields_ ),
+                        std::cend  ( fields_ ),
+                        [ name ]( auto && field ) noexcept
+                        {
+                            return field.name == name;
+                        }
+                    )
+                };
+
+                if ( it == std::cend( fields_ ) ) { return bytecode::program::unbound; }
+
+                return static_cast< std::uint32_t >( std::distance( std::cbegin( fields_ ), it ) );
+            }
+        );
+
+        return is_activated_;
+    }
+
+    /**
+     * Checks whether there is the column of the right type for each of the fields.
+     */
+    [[ nodiscard ]] bool matches( batch const & rows ) const noexcept
+    {
+        auto const & columns{ rows.columns() };
+
+        if ( std::size( columns ) < std::size( fields_ ) ) { return false; }
+
+        for ( std::size_t i{ 0u }; i < std::size( fields_ ); ++i )
+        {
+            if ( columns[ i ].type() != fields_[ i ].type ) { return false; }
+        }
+
+        return true;
+    }
+
+    /**
+     * Gets the value of the row in the same form the evaluator of objects gets it.
+     */
+    [[ nodiscard ]] static utils::any_value value( column const & column, std::size_t const row ) noexcept
+    {
+        switch ( column.type() )
+        {
+            case column_type::int32  : return column.values< std::int32_t >()[ row ];
+            case column_type::int64  : return column.values< std::int64_t >()[ row ];
+            case column_type::float64: return column.values< double       >()[ row ];
+            case column_type::string : return column.string( row );
+        }
+
+        return {};
+    }
+
+    /**
+     * Runs the test for the rows of the chunk reaching it.
+     */
+    void test
+    (
+        batch                 const & rows,
+        bytecode::instruction const & instruction,
+        std::size_t           const   first,
+        std::size_t           const   count,
+        std::uint64_t         const * active,
+        std::uint64_t               * result
+    ) const noexcept
+    {
+        auto const   index { program_.binding( instruction.operand ) };
+        auto const & column{ rows.columns()[ index ] };
+
+        if ( instruction.relation != token::token_type::in && instruction.relation != token::token_type::not_in )
+        {
+            auto const & literal{ program_.literal( instruction.literal ) };
+            auto const   integer{ literal.type() == utils::constant::kind::integer };
+
+            switch ( column.type() )
+            {
+                case column_type::int32:
+                    if
+                    (
+                        integer &&
+                        literal.integer() >= std::numeric_limits< std::int32_t >::min() &&
+                        literal.integer() <= std::numeric_limits< std::int32_t >::max()
+                    )
+                    {
+                        auto const constant{ static_cast< std::int32_t >( literal.integer() ) };
+                        compare( instruction.relation, isa_, column.values< std::int32_t >() + first, count, constant, active, result );
+                        return;
+                    }
+                    break;
+
+                case column_type::int64:
+                    if ( integer )
+                    {
+                        compare( instruction.relation, isa_, column.values< std::int64_t >() + first, count, literal.integer(), active, result );
+                        return;
+                    }
+                    break;
+
+                case column_type::float64:
+                    if ( literal.numeric() )
+                    {
+                        compare( instruction.relation, isa_, column.values< double >() + first, count, literal.number(), active, result );
+                        return;
+                    }
+                    break;
+
+                case column_type::string:
+                    break;
+            }
+        }
+
+        select( instruction, column, first, count, active, result );
+    }
+
+    /**
+     * Runs the test row by row, for the tests not having the kernel.
+     */
+    void select
+    (
+        bytecode::instruction const & instruction,
+        column                const & column,
+        std::size_t           const   first,
+        std::size_t           const   count,
+        std::uint64_t         const * active,
+        std::uint64_t               * result
+    ) const noexcept
+    {
+        constexpr auto bits{ utils::bitmap::word_bits };
+
+        for ( std::size_t w{ 0u }; w * bits < count; ++w )
+        {
+            auto const mask{ active[ w ] };
+
+            std::uint64_t selected{ 0u };
+            for ( auto m{ mask }; m != 0u; m &= m - 1u )
+            {
+                auto const bit{ utils::lowest_bit( m ) };
+                if ( satisfies( instruction, value( column, first + w * bits + bit ) ) )
+                {
+                    selected |= std::uint64_t{ 1u } << bit;
+                }
+            }
+
+            result[ w ] = ( result[ w ] & ~mask ) | selected;
+        }
+    }
+
+    [[ nodiscard ]] bool satisfies( bytecode::instruction const & instruction, utils::any_value const & value ) const noexcept
+    {
+        switch ( instruction.relation )
+        {
+            case token::token_type::in    : return program_.set( instruction.literal ).contains( value );
+            case token::token_type::not_in: return program_.set( instruction.literal ).excludes( value );
+
+            default:
+                break;
+        }
+
+        auto const & literal{ program_.literal( instruction.literal ) };
+
+        switch ( instruction.relation )
+        {
+            case token::token_type::eq : return value == literal;
+            case token::token_type::neq: return value != literal;
+            case token::token_type::gt : return value >  literal;
+            case token::token_type::lt : return value <  literal;
+            case token::token_type::geq: return value >= literal;
+            case token::token_type::leq: return value <= literal;
+
+            default:
+                return false;
+        }
+    }
+
+private:
+    bool                 is_activated_{ false };
+    instruction_set      isa_         { supported_instruction_set() };
+    std::vector< field > fields_      {};
+    tree::arena          parsed_      {};
+    tree::arena          tree_        {};
+    bytecode::program    program_     {};
+};
+
+} // namespace booleval::columnar
+
+#endif // BOOLEVAL_COLUMNAR_EVALUATOR_HPP
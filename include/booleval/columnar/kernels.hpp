@@ -0,0 +1,378 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef BOOLEVAL_KERNELS_HPP
+#define BOOLEVAL_KERNELS_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+
+#include <booleval/utils/bitmap.hpp>
+#include <booleval/utils/instruction_set.hpp>
+#include <booleval/token/token_type.hpp>
+
+namespace booleval::columnar
+{
+
+using utils::instruction_set;
+using utils::detect_instruction_set;
+using utils::supported_instruction_set;
+
+namespace internal
+{
+
+    /**
+     * Checks whether the integer comparison is computed as the negation of the other one,
+     * e.g. 'a geq b' as not 'a lt b', since SIMD instructions compare integers only by
+     * equal to and greater than. Floating point values are never negated because of NaN.
+     */
+    template< token::token_type R >
+    [[ nodiscard ]] constexpr bool negated() noexcept
+    {
+        return R == token::token_type::neq || R == token::token_type::leq || R == token::token_type::geq;
+    }
+
+    template< token::token_type R, typename T, typename U >
+    [[ nodiscard ]] constexpr bool compare( T const lhs, U const rhs ) noexcept
+    {
+        using common = std::common_type_t< T, U >;
+
+        auto const l{ static_cast< common >( lhs ) };
+        auto const r{ static_cast< common >( rhs ) };
+
+        if constexpr ( R == token::token_type::eq  ) { return l == r; }
+        if constexpr ( R == token::token_type::neq ) { return l != r; }
+        if constexpr ( R == token::token_type::gt  ) { return l >  r; }
+        if constexpr ( R == token::token_type::lt  ) { return l <  r; }
+        if constexpr ( R == token::token_type::geq ) { return l >= r; }
+        if constexpr ( R == token::token_type::leq ) { return l <= r; }
+    }
+
+} // namespace internal
+
+namespace scalar
+{
+
+    /**
+     * Compares up to 64 values with the constant.
+     *
+     * @param values   Pointer to the first value
+     * @param count    Number of the values
+     * @param constant Constant to compare the values with
+     *
+     * @return Mask of the values satisfying the comparison
+     */
+    template< token::token_type R, typename T, typename U >
+    [[ nodiscard ]] std::uint64_t compare_word( T const * values, std::size_t const count, U const constant ) noexcept
+    {
+        std::uint64_t mask{ 0u };
+        for ( std::size_t i{ 0u }; i < count; ++i )
+        {
+            mask |= std::uint64_t{ internal::compare< R >( values[ i ], constant ) } << i;
+        }
+        return mask;
+    }
+
+    template< token::token_type R, typename T >
+    [[ nodiscard ]] std::uint64_t compare_word( T const * values, T const constant ) noexcept
+    {
+        return compare_word< R >( values, utils::bitmap::word_bits, constant );
+    }
+
+} // namespace scalar
+
+#if defined( BOOLEVAL_SIMD )
+
+namespace sse42
+{
+
+    template< token::token_type R >
+    BOOLEVAL_TARGET( "sse4.2" ) [[ nodiscard ]] inline __m128i compare( __m128i const v, __m128i const c, std::int32_t ) noexcept
+    {
+        if constexpr ( R == token::token_type::eq || R == token::token_type::neq ) { return _mm_cmpeq_epi32( v, c ); }
+        if constexpr ( R == token::token_type::gt || R == token::token_type::leq ) { return _mm_cmpgt_epi32( v, c ); }
+        if constexpr ( R == token::token_type::lt || R == token::token_type::geq ) { return _mm_cmpgt_epi32( c, v ); }
+    }
+
+    template< token::token_type R >
+    BOOLEVAL_TARGET( "sse4.2" ) [[ nodiscard ]] inline __m128i compare( __m128i const v, __m128i const c, std::int64_t ) noexcept
+    {
+        if constexpr ( R == token::token_type::eq || R == token::token_type::neq ) { return _mm_cmpeq_epi64( v, c ); }
+        if constexpr ( R == token::token_type::gt || R == token::token_type::leq ) { return _mm_cmpgt_epi64( v, c ); }
+        if constexpr ( R == token::token_type::lt || R == token::token_type::geq ) { return _mm_cmpgt_epi64( c, v ); }
+    }
+
+    template< token::token_type R >
+    BOOLEVAL_TARGET( "sse4.2" ) [[ nodiscard ]] inline __m128d compare( __m128d const v, __m128d const c ) noexcept
+    {
+        if constexpr ( R == token::token_type::eq  ) { return _mm_cmpeq_pd ( v, c ); }
+        if constexpr ( R == token::token_type::neq ) { return _mm_cmpneq_pd( v, c ); }
+        if constexpr ( R == token::token_type::gt  ) { return _mm_cmpgt_pd ( v, c ); }
+        if constexpr ( R == token::token_type::lt  ) { return _mm_cmplt_pd ( v, c ); }
+        if constexpr ( R == token::token_type::geq ) { return _mm_cmpge_pd ( v, c ); }
+        if constexpr ( R == token::token_type::leq ) { return _mm_cmple_pd ( v, c ); }
+    }
+
+    template< token::token_type R >
+    BOOLEVAL_TARGET( "sse4.2" ) [[ nodiscard ]] inline std::uint64_t compare_word( std::int32_t const * values, std::int32_t const constant ) noexcept
+    {
+        auto const c{ _mm_set1_epi32( constant ) };
+
+        std::uint64_t mask{ 0u };
+        for ( std::size_t i{ 0u }; i < utils::bitmap::word_bits; i += 4u )
+        {
+            auto const v{ _mm_loadu_si128( reinterpret_cast< __m128i const * >( values + i ) ) };
+            auto const r{ compare< R >( v, c, std::int32_t{} ) };
+            mask |= std::uint64_t{ static_cast< unsigned >( _mm_movemask_ps( _mm_castsi128_ps( r ) ) ) } << i;
+        }
+
+        return internal::negated< R >() ? ~mask : mask;
+    }
+
+    template< token::token_type R >
+    BOOLEVAL_TARGET( "sse4.2" ) [[ nodiscard ]] inline std::uint64_t compare_word( std::int64_t const * values, std::int64_t const constant ) noexcept
+    {
+        auto const c{ _mm_set1_epi64x( constant ) };
+
+        std::uint64_t mask{ 0u };
+        for ( std::size_t i{ 0u }; i < utils::bitmap::word_bits; i += 2u )
+        {
+            auto const v{ _mm_loadu_si128( reinterpret_cast< __m128i const * >( values + i ) ) };
+            auto const r{ compare< R >( v, c, std::int64_t{} ) };
+            mask |= std::uint64_t{ static_cast< unsigned >( _mm_movemask_pd( _mm_castsi128_pd( r ) ) ) } << i;
+        }
+
+        return internal::negated< R >() ? ~mask : mask;
+    }
+
+    template< token::token_type R >
+    BOOLEVAL_TARGET( "sse4.2" ) [[ nodiscard ]] inline std::uint64_t compare_word( double const * values, double const constant ) noexcept
+    {
+        auto const c{ _mm_set1_pd( constant ) };
+
+        std::uint64_t mask{ 0u };
+        for ( std::size_t i{ 0u }; i < utils::bitmap::word_bits; i += 2u )
+        {
+            auto const v{ _mm_loadu_pd( values + i ) };
+            mask |= std::uint64_t{ static_cast< unsigned >( _mm_movemask_pd( compare< R >( v, c ) ) ) } << i;
+        }
+
+        return mask;
+    }
+
+} // namespace sse42
+
+namespace avx2
+{
+
+    template< token::token_type R >
+    BOOLEVAL_TARGET( "avx2" ) [[ nodiscard ]] inline __m256i compare( __m256i const v, __m256i const c, std::int32_t ) noexcept
+    {
+        if constexpr ( R == token::token_type::eq || R == token::token_type::neq ) { return _mm256_cmpeq_epi32( v, c ); }
+        if constexpr ( R == token::token_type::gt || R == token::token_type::leq ) { return _mm256_cmpgt_epi32( v, c ); }
+        if constexpr ( R == token::token_type::lt || R == token::token_type::geq ) { return _mm256_cmpgt_epi32( c, v ); }
+    }
+
+    template< token::token_type R >
+    BOOLEVAL_TARGET( "avx2" ) [[ nodiscard ]] inline __m256i compare( __m256i const v, __m256i const c, std::int64_t ) noexcept
+    {
+        if constexpr ( R == token::token_type::eq || R == token::token_type::neq ) { return _mm256_cmpeq_epi64( v, c ); }
+        if constexpr ( R == token::token_type::gt || R == token::token_type::leq ) { return _mm256_cmpgt_epi64( v, c ); }
+        if constexpr ( R == token::token_type::lt || R == token::token_type::geq ) { return _mm256_cmpgt_epi64( c, v ); }
+    }
+
+    template< token::token_type R >
+    BOOLEVAL_TARGET( "avx2" ) [[ nodiscard ]] inline __m256d compare( __m256d const v, __m256d const c ) noexcept
+    {
+        if constexpr ( R == token::token_type::eq  ) { return _mm256_cmp_pd( v, c, _CMP_EQ_OQ  ); }
+        if constexpr ( R == token::token_type::neq ) { return _mm256_cmp_pd( v, c, _CMP_NEQ_UQ ); }
+        if constexpr ( R == token::token_type::gt  ) { return _mm256_cmp_pd( v, c, _CMP_GT_OQ  ); }
+        if constexpr ( R == token::token_type::lt  ) { return _mm256_cmp_pd( v, c, _CMP_LT_OQ  ); }
+        if constexpr ( R == token::token_type::geq ) { return _mm256_cmp_pd( v, c, _CMP_GE_OQ  ); }
+        if constexpr ( R == token::token_type::leq ) { return _mm256_cmp_pd( v, c, _CMP_LE_OQ  ); }
+    }
+
+    template< token::token_type R >
+    BOOLEVAL_TARGET( "avx2" ) [[ nodiscard ]] inline std::uint64_t compare_word( std::int32_t const * values, std::int32_t const constant ) noexcept
+    {
+        auto const c{ _mm256_set1_epi32( constant ) };
+
+        std::uint64_t mask{ 0u };
+        for ( std::size_t i{ 0u }; i < utils::bitmap::word_bits; i += 8u )
+        {
+            auto const v{ _mm256_loadu_si256( reinterpret_cast< __m256i const * >( values + i ) ) };
+            auto const r{ compare< R >( v, c, std::int32_t{} ) };
+            mask |= std::uint64_t{ static_cast< unsigned >( _mm256_movemask_ps( _mm256_castsi256_ps( r ) ) ) } << i;
+        }
+
+        return internal::negated< R >() ? ~mask : mask;
+    }
+
+    template< token::token_type R >
+    BOOLEVAL_TARGET( "avx2" ) [[ nodiscard ]] inline std::uint64_t compare_word( std::int64_t const * values, std::int64_t const constant ) noexcept
+    {
+        auto const c{ _mm256_set1_epi64x( constant ) };
+
+        std::uint64_t mask{ 0u };
+        for ( std::size_t i{ 0u }; i < utils::bitmap::word_bits; i += 4u )
+        {
+            auto const v{ _mm256_loadu_si256( reinterpret_cast< __m256i const * >( values + i ) ) };
+            auto const r{ compare< R >( v, c, std::int64_t{} ) };
+            mask |= std::uint64_t{ static_cast< unsigned >( _mm256_movemask_pd( _mm256_castsi256_pd( r ) ) ) } << i;
+        }
+
+        return internal::negated< R >() ? ~mask : mask;
+    }
+
+    template< token::token_type R >
+    BOOLEVAL_TARGET( "avx2" ) [[ nodiscard ]] inline std::uint64_t compare_word( double const * values, double const constant ) noexcept
+    {
+        auto const c{ _mm256_set1_pd( constant ) };
+
+        std::uint64_t mask{ 0u };
+        for ( std::size_t i{ 0u }; i < utils::bitmap::word_bits; i += 4u )
+        {
+            auto const v{ _mm256_loadu_pd( values + i ) };
+            mask |= std::uint64_t{ static_cast< unsigned >( _mm256_movemask_pd( compare< R >( v, c ) ) ) } << i;
+        }
+
+        return mask;
+    }
+
+} // namespace avx2
+
+#endif // BOOLEVAL_SIMD
+
+namespace internal
+{
+
+    template< typename T >
+    using word_function = std::uint64_t ( * )( T const *, T ) noexcept;
+
+    template< token::token_type R, typename T >
+    [[ nodiscard ]] word_function< T > select_word( [[ maybe_unused ]] instruction_set const isa ) noexcept
+    {
+#if defined( BOOLEVAL_SIMD )
+        switch ( isa )
+        {
+            case instruction_set::avx2 : return static_cast< word_function< T > >( &avx2 ::compare_word< R > );
+            case instruction_set::sse42: return static_cast< word_function< T > >( &sse42::compare_word< R > );
+
+            default:
+                break;
+        }
+#endif
+
+        return &scalar::compare_word< R, T >;
+    }
+
+    /**
+     * Compares the values of the rows reaching the test with the constant, 64 rows at a time.
+     * Rows of the last word the batch ends in are compared one by one, so the values past
+     * the end of the batch are never read.
+     */
+    template< token::token_type R, typename T >
+    void compare
+    (
+        instruction_set const   isa,
+        T               const * values,
+        std::size_t     const   rows,
+        T               const   constant,
+        std::uint64_t   const * active,
+        std::uint64_t         * result
+    ) noexcept
+    {
+        constexpr auto bits{ utils::bitmap::word_bits };
+
+        auto const word { select_word< R, T >( isa ) };
+        auto const words{ ( rows + bits - 1u ) / bits };
+
+        for ( std::size_t w{ 0u }; w < words; ++w )
+        {
+            auto const mask{ active[ w ] };
+            if ( mask == 0u ) { continue; }
+
+            auto const count{ std::min( bits, rows - w * bits ) };
+            auto const selected
+            {
+                count == bits
+                    ? word( values + w * bits, constant )
+                    : scalar::compare_word< R >( values + w * bits, count, constant )
+            };
+
+            result[ w ] = ( result[ w ] & ~mask ) | ( selected & mask );
+        }
+    }
+
+} // namespace internal
+
+/**
+ * Compares the values of the column with the constant and stores the outcome of the rows
+ * reaching the test into their result registers. Rows that do not reach the test are left
+ * as they are. Words of 64 rows none of which reaches the test are skipped.
+ *
+ * @param relation Relational operation
+ * @param isa      Instruction set to run the comparison with
+ * @param values   Pointer to the value of the first row
+ * @param rows     Number of the rows
+ * @param constant Constant to compare the values with
+ * @param active   Masks of the rows reaching the test
+ * @param result   Result registers of the rows
+ */
+template< typename T >
+void compare
+(
+    token::token_type const   relation,
+    instruction_set   const   isa,
+    T                 const * values,
+    std::size_t       const   rows,
+    T                 const   constant,
+    std::uint64_t     const * active,
+    std::uint64_t           * result
+) noexcept
+{
+    switch ( relation )
+    {
+        case token::token_type::eq : internal::compare< token::token_type::eq  >( isa, values, rows, constant, active, result ); break;
+        case token::token_type::neq: internal::compare< token::token_type::neq >( isa, values, rows, constant, active, result ); break;
+        case token::token_type::gt : internal::compare< token::token_type::gt  >( isa, values, rows, constant, active, result ); break;
+        case token::token_type::lt : internal::compare< token::token_type::lt  >( isa, values, rows, constant, active, result ); break;
+        case token::token_type::geq: internal::compare< token::token_type::geq >( isa, values, rows, constant, active, result ); break;
+        case token::token_type::leq: internal::compare< token::token_type::leq >( isa, values, rows, constant, active, result ); break;
+
+        default:
+            break;
+    }
+}
+
+} // namespace booleval::columnar
+
+#endif // BOOLEVAL_KERNELS_HPP
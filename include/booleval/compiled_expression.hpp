@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef BOOLEVAL_COMPILED_EXPRESSION_HPP
+#define BOOLEVAL_COMPILED_EXPRESSION_HPP
+
+#include <memory>
+#include <string_view>
+#include <initializer_list>
+
+#include <booleval/field.hpp>
+#include <booleval/result.hpp>
+#include <booleval/typed_field.hpp>
+#include <booleval/utils/bitmap.hpp>
+#include <booleval/tree/tree.hpp>
+#include <booleval/tree/arena.hpp>
+#include <booleval/tree/optimizer.hpp>
+#include <booleval/bytecode/program.hpp>
+#include <booleval/bytecode/compiler.hpp>
+#include <booleval/bytecode/interpreter.hpp>
+
+namespace booleval
+{
+
+namespace internal
+{
+
+    /**
+     * Builds the expression tree, optimizes it and compiles it into the program.
+     * Program refers to the text of the optimized tree, so the tree must not be
+     * modified nor moved as long as the program is used.
+     *
+     * @param expression Expression to compile
+     * @param parsed     Arena to build the expression tree into before it gets optimized
+     * @param tree       Arena to store the optimized expression tree into
+     * @param program    Program to compile the optimized expression tree into
+     *
+     * @return True if the expression is successfully compiled, otherwise false
+     */
+    inline bool compile
+    (
+        std::string_view  const   expression,
+        tree::arena             & parsed,
+        tree::arena             & tree,
+        bytecode::program       & program
+    )
+    {
+        if ( !tree::build( expression, parsed ) )
+        {
+            program.clear();
+            return false;
+        }
+
+        tree::optimize( parsed, tree );
+
+        if ( !bytecode::compile( tree, program ) )
+        {
+            program.clear();
+            return false;
+        }
+
+        return true;
+    }
+
+} // namespace internal
+
+/**
+ * @class basic_compiled_expression
+ *
+ * Represents the compiled expression together with the fields it is bound to.
+ * Once compiled, it is never modified, so one compiled expression can be shared
+ * by any number of threads evaluating it at the same time, without any
+ * synchronization. Evaluation does not keep any state between the calls.
+ *
+ * Since the program refers to the text of its expression tree, compiled expression
+ * is neither copied nor moved, but it is created on the heap and shared by a
+ * reference-counted pointer.
+ */
+template< typename Interpreter >
+class basic_compiled_expression
+{
+public:
+    using field_type = typename Interpreter::input_type;
+
+    basic_compiled_expression( basic_compiled_expression       && rhs ) = delete;
+    basic_compiled_expression( basic_compiled_expression const  & rhs ) = delete;
+
+    basic_compiled_expression & operator=( basic_compiled_expression       && rhs ) = delete;
+    basic_compiled_expression & operator=( basic_compiled_expression const  & rhs ) = delete;
+
+    ~basic_compiled_expression() = default;
+
+    /**
+     * Compiles the expression and binds its field names to the specified fields.
+     * Compiled expression is returned even if the expression is invalid, in which
+     * case it is not activated and its evaluation reports the error.
+     *
+     * @param expression Expression to compile
+     * @param fields     Fields to be used in evaluation process
+     *
+     * @return Shared pointer to the immutable compiled expression
+     */
+    [[ nodiscard ]] static std::shared_ptr< basic_compiled_expression const > compile
+    (
+        std::string_view                    const expression,
+        std::initializer_list< field_type > const fields
+    )
+    {
+        std::shared_ptr< basic_compiled_expression > result{ new basic_compiled_expression{} };
+        result->interpreter_.fields( fields );
+
+        if ( expression.empty() ) { return result; }
+
+        tree::arena parsed{};
+        if ( !internal::compile( expression, parsed, result->tree_, result->program_ ) )
+        {
+            return result;
+        }
+
+        result->is_activated_ = result->interpreter_.bind( result->program_ );
+        result->error_        = result->is_activated_ ? "Evaluator not activated" : "Unknown field";
+
+        return result;
+    }
+
+    /**
+     * Checks whether the evaluation is activated or not, i.e.
+     * if the expression is valid and all of its fields are known.
+     *
+     * @return True if the evaluation is activated, otherwise false
+     */
+    [[ nodiscard ]] bool is_activated() const noexcept
+    {
+        return is_activated_;
+    }
+
+    /**
+     * Evaluates the expression for the object passed in.
+     * Safe to be called from multiple threads at the same time.
+     *
+     * @param obj Object to be evaluated
+     *
+     * @return True if the object's members satisfy the expression, otherwise false
+     */
+    template< typename T >
+    [[ nodiscard ]] result evaluate( T && obj ) const noexcept
+    {
+        if ( is_activated_ )
+        {
+            return interpreter_.run( program_, std::forward< T >( obj ) );
+        }
+        else
+        {
+            return { false, error_ };
+        }
+    }
+
+    /**
+     * Evaluates the expression for the batch of objects stored contiguously, e.g. in the
+     * vector or the array. Each test of the expression is run across the whole batch at
+     * once. Objects whose evaluation fails are not selected, while none of them is selected
+     * if the evaluation is not activated.
+     *
+     * @param objects   Objects to be evaluated
+     * @param selection Bitmap to set the bits of the objects satisfying the expression in
+     *
+     * @return True if the batch is evaluated, otherwise false
+     */
+    template< typename Range >
+    bool evaluate_batch( Range const & objects, utils::bitmap & selection ) const
+    {
+        if ( !is_activated_ )
+        {
+            selection.reset( std::size( objects ) );
+            return false;
+        }
+
+        return interpreter_.run( program_, std::data( objects ), std::size( objects ), selection );
+    }
+
+    /**
+     * Evaluates the expression for the batch of objects stored contiguously.
+     *
+     * @param objects Objects to be evaluated
+     *
+     * @return Bitmap of the objects satisfying the expression
+     */
+    template< typename Range >
+    [[ nodiscard ]] utils::bitmap evaluate_batch( Range const & objects ) const
+    {
+        utils::bitmap selection{};
+        evaluate_batch( objects, selection );
+        return selection;
+    }
+
+private:
+    basic_compiled_expression() = default;
+
+private:
+    bool              is_activated_{ false };
+    std::string_view  error_       { "Evaluator not activated" };
+    tree::arena       tree_        {};
+    bytecode::program program_     {};
+    Interpreter       interpreter_ {};
+};
+
+/**
+ * Compiled expression of the fields of any class, created by make_field.
+ */
+using compiled_expression = basic_compiled_expression< bytecode::interpreter >;
+
+/**
+ * Compiled expression of the fields of the class known at compile time.
+ */
+template< typename T >
+using typed_compiled_expression = basic_compiled_expression< bytecode::typed_interpreter< T > >;
+
+} // namespace booleval
+
+#endif // BOOLEVAL_COMPILED_EXPRESSION_HPP
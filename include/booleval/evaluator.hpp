@@ -30,50 +30,68 @@
 #ifndef BOOLEVAL_EVALUATOR_HPP
 #define BOOLEVAL_EVALUATOR_HPP
 
-#include <memory>
+#include <cstdint>
 #include <string_view>
 #include <initializer_list>
 
 #include <booleval/field.hpp>
 #include <booleval/result.hpp>
-#include <booleval/tree/result_visitor.hpp>
-#include <booleval/tree/tree.hpp>
+#include <booleval/typed_field.hpp>
+#include <booleval/utils/bitmap.hpp>
+#include <booleval/expression_cache.hpp>
+#include <booleval/compiled_expression.hpp>
+#include <booleval/tree/arena.hpp>
+#include <booleval/bytecode/program.hpp>
+#include <booleval/bytecode/interpreter.hpp>
 
 namespace booleval
 {
 
 /**
- * @class evaluator
+ * @class basic_evaluator
  *
  * Represents a class for evaluating logical expressions in a form of a string.
- * It builds an expression tree and traverses that tree in order to evaluate fields.
+ * It builds an expression tree, optimizes it, compiles it into a bytecode program
+ * and runs that program in order to evaluate fields. Interpreter determines the
+ * kind of fields the evaluator works with.
  */
-class evaluator
+template< typename Interpreter >
+class basic_evaluator
 {
 public:
-    evaluator() noexcept = default;
+    using field_type = typename Interpreter::input_type;
 
-    evaluator( evaluator       && rhs ) noexcept = default;
-    evaluator( evaluator const  & rhs ) noexcept = delete;
+    basic_evaluator() noexcept = default;
 
-    evaluator( std::initializer_list< field_base * > fields ) noexcept
+    basic_evaluator( basic_evaluator       && rhs ) noexcept = default;
+    basic_evaluator( basic_evaluator const  & rhs ) noexcept = delete;
+
+    basic_evaluator( std::initializer_list< field_type > fields ) noexcept
     {
-        result_visitor_.fields( fields );
+        interpreter_.fields( fields );
     }
 
-    evaluator& operator=( evaluator       && rhs ) noexcept = default;
-    evaluator& operator=( evaluator const  & rhs ) noexcept = delete;
+    basic_evaluator& operator=( basic_evaluator       && rhs ) noexcept = default;
+    basic_evaluator& operator=( basic_evaluator const  & rhs ) noexcept = delete;
 
-    ~evaluator() noexcept = default;
+    ~basic_evaluator() noexcept = default;
 
     /**
      * Sets the fields used for evaluation of expression tree.
+     * Field names of the current expression are bound to the new fields,
+     * while the other cached expressions are bound once they are used again.
      *
      * @param fields Fields to be used in evaluation process
      */
-    void fields( std::initializer_list< field_base * > fields ) noexcept
+    void fields( std::initializer_list< field_type > fields ) noexcept
     {
-        result_visitor_.fields( fields );
+        interpreter_.fields( fields );
+        ++generation_;
+
+        if ( current_ != nullptr )
+        {
+            bind();
+        }
     }
 
     /**
@@ -89,24 +107,86 @@ public:
 
     /**
      * Sets the expression to be used for evaluation.
+     * If the expression cache is enabled, compiled expressions are cached by their text, so setting
+     * the recently used expression again does not build nor compile it, but only looks it up in the
+     * cache. Otherwise, storage of the least recently used expression is reused for the new one.
+     * Field names are resolved here, so an unknown field makes the expression invalid.
      *
      * @param expression Expression to be used for evaluation
      *
-     * @return True if the expression is valid, otherwise false
+     * @return True if the expression is valid and all of its fields are known, otherwise false
      */
     [[ nodiscard ]] bool expression( std::string_view const expression ) noexcept
     {
         is_activated_ = false;
+        error_        = "Evaluator not activated";
+        current_      = nullptr;
 
         if ( expression.empty() ) { return true; }
 
-        root_ = tree::build( expression );
-        if ( root_ != nullptr )
+        current_ = cache_.find( expression );
+        if ( current_ != nullptr )
         {
-            is_activated_ = true;
+            return current_->generation == generation_ ? activate() : bind();
         }
 
-        return is_activated_;
+        auto & entry{ cache_.insert( expression ) };
+
+        if ( !internal::compile( expression, parsed_, entry.tree, entry.program ) )
+        {
+            cache_.erase( expression );
+            return false;
+        }
+
+        current_ = &entry;
+        return bind();
+    }
+
+    /**
+     * Binds the value of the parameter of the current expression, e.g. the value of '?'
+     * in 'field_a gt ?'. Parameters are numbered from zero, in the order of their appearance
+     * in the expression. Expression is not built nor compiled again. Cached expressions keep
+     * the values of their parameters until they are bound again.
+     *
+     * @param number Parameter number
+     * @param value  Value of the parameter, either string or arithmetic value
+     *
+     * @return True if the current expression has such parameter and it is not a set, otherwise false
+     */
+    template< typename T >
+    bool parameter( std::uint32_t const number, T const & value )
+    {
+        return current_ != nullptr && current_->program.parameter( number, value );
+    }
+
+    /**
+     * Binds the values of the set parameter of the current expression, e.g. the values of '?'
+     * in 'field_a in (?)'.
+     *
+     * @param number Parameter number
+     * @param first  Iterator to the first value, either string or arithmetic value
+     * @param last   Iterator past the last value
+     *
+     * @return True if the current expression has such parameter and it is a set, otherwise false
+     */
+    template< typename InputIt >
+    bool parameter( std::uint32_t const number, InputIt const first, InputIt const last )
+    {
+        return current_ != nullptr && current_->program.parameter( number, first, last );
+    }
+
+    /**
+     * Binds the values of the set parameter of the current expression.
+     *
+     * @param number Parameter number
+     * @param values Values of the parameter
+     *
+     * @return True if the current expression has such parameter and it is a set, otherwise false
+     */
+    template< typename T >
+    bool parameter( std::uint32_t const number, std::initializer_list< T > const values )
+    {
+        return parameter( number, std::begin( values ), std::end( values ) );
     }
 
     /**
@@ -121,20 +201,122 @@ public:
     {
         if ( is_activated_ )
         {
-            return result_visitor_.visit( *root_, std::forward< T >( obj ) );
+            return interpreter_.run( current_->program, std::forward< T >( obj ) );
         }
         else
         {
-            return { false, "Evaluator not activated" };
+            return { false, error_ };
         }
     }
 
+    /**
+     * Evaluates the expression for the batch of objects stored contiguously, e.g. in the
+     * vector or the array. Each test of the expression is run across the whole batch at
+     * once. Objects whose evaluation fails are not selected, while none of them is selected
+     * if the evaluation is not activated.
+     *
+     * @param objects   Objects to be evaluated
+     * @param selection Bitmap to set the bits of the objects satisfying the expression in
+     *
+     * @return True if the batch is evaluated, otherwise false
+     */
+    template< typename Range >
+    bool evaluate_batch( Range const & objects, utils::bitmap & selection )
+    {
+        if ( !is_activated_ )
+        {
+            selection.reset( std::size( objects ) );
+            return false;
+        }
+
+        return interpreter_.run( current_->program, std::data( objects ), std::size( objects ), selection );
+    }
+
+    /**
+     * Evaluates the expression for the batch of objects stored contiguously.
+     *
+     * @param objects Objects to be evaluated
+     *
+     * @return Bitmap of the objects satisfying the expression
+     */
+    template< typename Range >
+    [[ nodiscard ]] utils::bitmap evaluate_batch( Range const & objects )
+    {
+        utils::bitmap selection{};
+        evaluate_batch( objects, selection );
+        return selection;
+    }
+
+    /**
+     * Sets the maximum number of the compiled expressions kept in the cache.
+     * Cache is disabled by default, i.e. its capacity is zero.
+     *
+     * @param capacity Maximum number of the cached expressions, zero to disable the cache
+     */
+    void cache_capacity( std::size_t const capacity )
+    {
+        cache_.capacity( capacity );
+    }
+
+    /**
+     * Gets the cache of the compiled expressions, e.g. to inspect its hit and miss counters.
+     *
+     * @return Expression cache
+     */
+    [[ nodiscard ]] expression_cache const & cache() const noexcept
+    {
+        return cache_;
+    }
+
+private:
+    /**
+     * Binds field names of the current program to the fields of the interpreter.
+     *
+     * @return True if all the fields are known, otherwise false
+     */
+    bool bind() noexcept
+    {
+        current_->bound      = interpreter_.bind( current_->program );
+        current_->generation = generation_;
+
+        return activate();
+    }
+
+    /**
+     * Activates the evaluation if the current program is bound.
+     *
+     * @return True if the evaluation is activated, otherwise false
+     */
+    bool activate() noexcept
+    {
+        is_activated_ = current_->bound;
+        error_        = is_activated_ ? "Evaluator not activated" : "Unknown field";
+
+        return is_activated_;
+    }
+
 private:
-    bool                          is_activated_  { false   };
-    std::unique_ptr< tree::node > root_          { nullptr };
-    tree::result_visitor          result_visitor_{};
+    bool                      is_activated_{ false };
+    std::string_view          error_       { "Evaluator not activated" };
+    tree::arena               parsed_      {};
+    expression_cache          cache_       {};
+    expression_cache::entry * current_     { nullptr };
+    std::uint64_t             generation_  { 1u };
+    Interpreter               interpreter_ {};
 };
 
+/**
+ * Evaluator of the fields of any class, created by make_field.
+ */
+using evaluator = basic_evaluator< bytecode::interpreter >;
+
+/**
+ * Evaluator of the fields of the class known at compile time. Fields are
+ * plain typed_field values and are invoked without RTTI or std::function.
+ */
+template< typename T >
+using typed_evaluator = basic_evaluator< bytecode::typed_interpreter< T > >;
+
 } // namespace booleval
 
 #endif // BOOLEVAL_EVALUATOR_HPP
\ No newline at end of file
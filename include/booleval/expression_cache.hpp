@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef BOOLEVAL_EXPRESSION_CACHE_HPP
+#define BOOLEVAL_EXPRESSION_CACHE_HPP
+
+#include <list>
+#include <string>
+#include <cstdint>
+#include <algorithm>
+#include <string_view>
+#include <unordered_map>
+
+#include <booleval/tree/arena.hpp>
+#include <booleval/bytecode/program.hpp>
+
+namespace booleval
+{
+
+/**
+ * @class expression_cache
+ *
+ * Represents the bounded cache of the compiled expressions keyed by the expression text.
+ * When the cache is full, the least recently used expression is evicted and its storage
+ * is reused for the new one. The most recently inserted expression is always stored,
+ * even if the capacity is zero, i.e. if the cache is disabled and never finds anything.
+ *
+ * Program refers to the text of its expression tree, so both of them are stored within
+ * the same entry and entries never move in memory. Pointers to the entries stay valid
+ * until the entries are evicted.
+ */
+class expression_cache
+{
+public:
+    /**
+     * @struct entry
+     *
+     * Represents the compiled expression together with the state of its binding.
+     */
+    struct entry
+    {
+        std::string       text      {};
+        tree::arena       tree      {};
+        bytecode::program program   {};
+        std::uint64_t     generation{ 0u    };
+        bool              bound     { false };
+    };
+
+    expression_cache() = default;
+
+    explicit expression_cache( std::size_t const capacity ) noexcept
+        : capacity_{ capacity }
+    {}
+
+    expression_cache( expression_cache       && rhs ) = default;
+    expression_cache( expression_cache const  & rhs ) = delete;
+
+    expression_cache & operator=( expression_cache       && rhs ) = default;
+    expression_cache & operator=( expression_cache const  & rhs ) = delete;
+
+    ~expression_cache() = default;
+
+    /**
+     * Sets the maximum number of the cached expressions, evicting the least recently used
+     * ones if there are too many of them. The most recently used expression is always kept.
+     *
+     * @param capacity Maximum number of the cached expressions, zero to disable the cache
+     */
+    void capacity( std::size_t const capacity )
+    {
+        capacity_ = capacity;
+
+        while ( std::size( entries_ ) > limit() )
+        {
+            index_.erase( entries_.back().text );
+            entries_.pop_back();
+        }
+    }
+
+    /**
+     * Finds the compiled expression and marks it as the most recently used one.
+     *
+     * @param expression Expression text
+     *
+     * @return Pointer to the entry if the expression is cached, otherwise nullptr
+     */
+    [[ nodiscard ]] entry * find( std::string_view const expression )
+    {
+        if ( capacity_ == 0u ) { return nullptr; }
+
+        auto const it{ index_.find( expression ) };
+        if ( it == std::end( index_ ) )
+        {
+            ++misses_;
+            return nullptr;
+        }
+
+        ++hits_;
+        entries_.splice( std::begin( entries_ ), entries_, it->second );
+        return &entries_.front();
+    }
+
+    /**
+     * Inserts the entry for the expression that is not cached yet as the most recently
+     * used one. If the cache is full, the storage of the least recently used entry is reused.
+     *
+     * @param expression Expression text
+     *
+     * @return Entry to compile the expression into
+     */
+    entry & insert( std::string_view const expression )
+    {
+        if ( std::size( entries_ ) < limit() )
+        {
+            entries_.emplace_front();
+        }
+        else
+        {
+            index_.erase( entries_.back().text );
+            entries_.splice( std::begin( entries_ ), entries_, std::prev( std::end( entries_ ) ) );
+        }
+
+        auto & front{ entries_.front() };
+        front.text.assign( std::data( expression ), std::size( expression ) );
+        front.generation = 0u;
+        front.bound      = false;
+
+        index_.emplace( front.text, std::begin( entries_ ) );
+        return front;
+    }
+
+    /**
+     * Removes the expression from the cache, e.g. if it cannot be compiled.
+     *
+     * @param expression Expression text
+     */
+    void erase( std::string_view const expression )
+    {
+        auto const it{ index_.find( expression ) };
+        if ( it == std::end( index_ ) ) { return; }
+
+        auto const position{ it->second };
+        index_  .erase( it       );
+        entries_.erase( position );
+    }
+
+    /**
+     * Removes all the cached expressions. Hit and miss counters are kept.
+     */
+    void clear() noexcept
+    {
+        index_  .clear();
+        entries_.clear();
+    }
+
+    [[ nodiscard ]] std::size_t   capacity() const noexcept { return capacity_;           }
+    [[ nodiscard ]] std::size_t   size    () const noexcept { return std::size( entries_ ); }
+    [[ nodiscard ]] bool          empty   () const noexcept { return entries_.empty();     }
+    [[ nodiscard ]] std::uint64_t hits    () const noexcept { return hits_;                }
+    [[ nodiscard ]] std::uint64_t misses  () const noexcept { return misses_;              }
+
+private:
+    using entries = std::list< entry >;
+
+    [[ nodiscard ]] std::size_t limit() const noexcept
+    {
+        return std::max< std::size_t >( capacity_, 1u );
+    }
+
+private:
+    std::size_t                                                capacity_{ 0u };
+    entries                                                    entries_ {};
+    std::unordered_map< std::string_view, entries::iterator > index_   {};
+    std::uint64_t                                              hits_    { 0u };
+    std::uint64_t                                              misses_  { 0u };
+};
+
+} // namespace booleval
+
+#endif // BOOLEVAL_EXPRESSION_CACHE_HPP
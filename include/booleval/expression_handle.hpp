@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef BOOLEVAL_EXPRESSION_HANDLE_HPP
+#define BOOLEVAL_EXPRESSION_HANDLE_HPP
+
+#include <mutex>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+
+#include <booleval/result.hpp>
+#include <booleval/compiled_expression.hpp>
+
+namespace booleval
+{
+
+/**
+ * @class basic_expression_handle
+ *
+ * Represents the handle of the compiled expression that is replaced at runtime while
+ * other threads keep evaluating it. New expression is published by a single atomic
+ * store, while the readers neither block nor take any lock.
+ *
+ * Replaced expressions are reclaimed by the epoch-based scheme. Every evaluation announces
+ * the global epoch it started in before it loads the current expression. Publishing retires
+ * the previous expression with the epoch it was replaced in and advances the global epoch.
+ * Retired expression is released once no evaluation announced the epoch it was retired in,
+ * or any older one, since only those evaluations may still refer to it.
+ *
+ * Each thread evaluates through its own reader, which must not outlive the handle.
+ * Publishing is serialized between the writers.
+ */
+template< typename Interpreter >
+class basic_expression_handle
+{
+public:
+    using expression_type = basic_compiled_expression< Interpreter >;
+    using pointer         = std::shared_ptr< expression_type const >;
+
+private:
+    static constexpr std::uint64_t idle{ std::numeric_limits< std::uint64_t >::max() };
+
+    /**
+     * @struct slot
+     *
+     * Represents the epoch announced by one reader, or idle if the reader is not evaluating.
+     * Slots are never removed from the list, but released slots are reused by new readers.
+     */
+    struct slot
+    {
+        std::atomic< std::uint64_t > epoch { idle    };
+        std::atomic< bool          > in_use{ true    };
+        slot                       * next  { nullptr };
+    };
+
+public:
+    /**
+     * @class guard
+     *
+     * Keeps the expression loaded by the reader alive as long as the guard exists.
+     * Reader has at most one guard at a time.
+     */
+    class guard
+    {
+    public:
+        guard( guard       && rhs ) noexcept : slot_{ std::exchange( rhs.slot_, nullptr ) }, expression_{ rhs.expression_ } {}
+        guard( guard const  & rhs ) = delete;
+
+        guard & operator=( guard       && rhs ) = delete;
+        guard & operator=( guard const  & rhs ) = delete;
+
+        ~guard() noexcept
+        {
+            if ( slot_ != nullptr )
+            {
+                slot_->epoch.store( idle, std::memory_order_release );
+            }
+        }
+
+        [[ nodiscard ]] expression_type const * get       () const noexcept { return expression_;            }
+        [[ nodiscard ]] expression_type const * operator->() const noexcept { return expression_;            }
+        [[ nodiscard ]] explicit                operator bool() const noexcept { return expression_ != nullptr; }
+
+    private:
+        friend class basic_expression_handle;
+
+        guard( slot * const s, expression_type const * const expression ) noexcept
+            : slot_      { s          }
+            , expression_{ expression }
+        {}
+
+    private:
+        slot                  * slot_      { nullptr };
+        expression_type const * expression_{ nullptr };
+    };
+
+    /**
+     * @class reader
+     *
+     * Represents the registration of one evaluating thread.
+     */
+    class reader
+    {
+    public:
+        reader( reader       && rhs ) noexcept : handle_{ rhs.handle_ }, slot_{ std::exchange( rhs.slot_, nullptr ) } {}
+        reader( reader const  & rhs ) = delete;
+
+        reader & operator=( reader       && rhs ) = delete;
+        reader & operator=( reader const  & rhs ) = delete;
+
+        ~reader() noexcept
+        {
+            if ( slot_ != nullptr )
+            {
+                slot_->in_use.store( false, std::memory_order_release );
+            }
+        }
+
+        /**
+         * Loads the current expression and keeps it alive until the guard is destroyed.
+         *
+         * @return Guard of the current expression
+         */
+        [[ nodiscard ]] guard lock() const noexcept
+        {
+            // announcing the epoch has to be ordered before loading the expression
+            slot_->epoch.store( handle_->epoch_.load( std::memory_order_seq_cst ), std::memory_order_seq_cst );
+
+            return { slot_, handle_->current_.load( std::memory_order_seq_cst ) };
+        }
+
+        /**
+         * Evaluates the current expression for the object passed in.
+         *
+         * @param obj Object to be evaluated
+         *
+         * @return True if the object's members satisfy the expression, otherwise false
+         */
+        template< typename T >
+        [[ nodiscard ]] result evaluate( T && obj ) const noexcept
+        {
+            auto const expression{ lock() };
+
+            if ( !expression )
+            {
+                return { false, "Evaluator not activated" };
+            }
+
+            return expression->evaluate( std::forward< T >( obj ) );
+        }
+
+    private:
+        friend class basic_expression_handle;
+
+        reader( basic_expression_handle const * const handle, slot * const s ) noexcept
+            : handle_{ handle }
+            , slot_  { s      }
+        {}
+
+    private:
+        basic_expression_handle const * handle_{ nullptr };
+        slot                          * slot_  { nullptr };
+    };
+
+    basic_expression_handle() = default;
+
+    explicit basic_expression_handle( pointer expression )
+    {
+        publish( std::move( expression ) );
+    }
+
+    basic_expression_handle( basic_expression_handle       && rhs ) = delete;
+    basic_expression_handle( basic_expression_handle const  & rhs ) = delete;
+
+    basic_expression_handle & operator=( basic_expression_handle       && rhs ) = delete;
+    basic_expression_handle & operator=( basic_expression_handle const  & rhs ) = delete;
+
+    ~basic_expression_handle() noexcept
+    {
+        for ( auto * s{ slots_.load( std::memory_order_acquire ) }; s != nullptr; )
+        {
+            delete std::exchange( s, s->next );
+        }
+    }
+
+    /**
+     * Registers the evaluating thread, reusing the slot of a destroyed reader if there is one.
+     *
+     * @return Reader
+     */
+    [[ nodiscard ]] reader make_reader()
+    {
+        for ( auto * s{ slots_.load( std::memory_order_acquire ) }; s != nullptr; s = s->next )
+        {
+            auto expected{ false };
+            if ( s->in_use.compare_exchange_strong( expected, true, std::memory_order_acq_rel ) )
+            {
+                return { this, s };
+            }
+        }
+
+        auto * const s{ new slot{} };
+        s->next = slots_.load( std::memory_order_relaxed );
+        while ( !slots_.compare_exchange_weak( s->next, s, std::memory_order_release, std::memory_order_relaxed ) ) {}
+
+        return { this, s };
+    }
+
+    /**
+     * Publishes the new expression. Evaluations starting afterwards use the new expression,
+     * while the ones already running finish with the previous one, which is reclaimed later.
+     *
+     * @param expression Expression to publish
+     */
+    void publish( pointer expression )
+    {
+        std::lock_guard< std::mutex > const lock{ mutex_ };
+
+        current_.store( expression.get(), std::memory_order_seq_cst );
+
+        auto const epoch{ epoch_.fetch_add( 1u, std::memory_order_seq_cst ) };
+        if ( owner_ != nullptr )
+        {
+            retired_.emplace_back( std::move( owner_ ), epoch );
+        }
+        owner_ = std::move( expression );
+
+        collect();
+    }
+
+    /**
+     * Gets the current expression. Meant for the writers, since it takes the lock.
+     *
+     * @return Current expression
+     */
+    [[ nodiscard ]] pointer load() const
+    {
+        std::lock_guard< std::mutex > const lock{ mutex_ };
+        return owner_;
+    }
+
+    /**
+     * Releases the replaced expressions no evaluation refers to anymore.
+     *
+     * @return Number of the replaced expressions still waiting to be released
+     */
+    std::size_t reclaim()
+    {
+        std::lock_guard< std::mutex > const lock{ mutex_ };
+        return collect();
+    }
+
+private:
+    std::size_t collect()
+    {
+        auto oldest{ idle };
+        for ( auto * s{ slots_.load( std::memory_order_acquire ) }; s != nullptr; s = s->next )
+        {
+            oldest = std::min( oldest, s->epoch.load( std::memory_order_seq_cst ) );
+        }
+
+        retired_.erase
+        (
+            std::remove_if
+            (
+                std::begin( retired_ ),
+                std::end  ( retired_ ),
+                [ oldest ]( auto const & retired ) noexcept
+                {
+                    return retired.second < oldest;
+                }
+            ),
+            std::end( retired_ )
+        );
+
+        return std::size( retired_ );
+    }
+
+private:
+    std::atomic< expression_type const * >                  current_{ nullptr };
+    std::atomic< std::uint64_t >                            epoch_  { 0u      };
+    std::atomic< slot * >                                   slots_  { nullptr };
+    mutable std::mutex                                      mutex_  {};
+    pointer                                                 owner_  {};
+    std::vector< std::pair< pointer, std::uint64_t > >      retired_{};
+};
+
+/**
+ * Handle of the compiled expression of the fields of any class, created by make_field.
+ */
+using expression_handle = basic_expression_handle< bytecode::interpreter >;
+
+/**
+ * Handle of the compiled expression of the fields of the class known at compile time.
+ */
+template< typename T >
+using typed_expression_handle = basic_expression_handle< bytecode::typed_interpreter< T > >;
+
+} // namespace booleval
+
+#endif // BOOLEVAL_EXPRESSION_HANDLE_HPP
@@ -32,6 +32,7 @@
 
 #include <functional>
 #include <string_view>
+#include <type_traits>
 #include <booleval/utils/any_value.hpp>
 
 namespace booleval
@@ -60,13 +61,25 @@ struct field_base
     virtual ~field_base() = default;
 
     template< typename C >
-    utils::any_value invoke( C && obj ) noexcept
+    utils::any_value invoke( C && obj ) const noexcept
     {
-        auto const * f{ dynamic_cast< field< std::remove_reference_t< C > >* >( this ) };
+        using type = std::remove_cv_t< std::remove_reference_t< C > >;
+
+        auto const * f{ dynamic_cast< field< type > const * >( this ) };
 
         if ( f == nullptr ) { return {}; }
 
-        return f->get( std::move( obj ));
+        if constexpr ( std::is_const_v< std::remove_reference_t< C > > )
+        {
+            // const objects are read only by const getters and data members
+            if ( !f->get_const ) { return {}; }
+
+            return f->get_const( obj );
+        }
+        else
+        {
+            return f->get( std::move( obj ) );
+        }
     }
 
     std::string_view name{};
@@ -77,6 +90,12 @@ struct field_base
  *
  * Contains string representation of a certain class field and
  * getter class member function associated to this field.
+ * Getters returning std::string const &, std::string_view or char const *
+ * are compared in place without copying the string. Public data members
+ * can be used instead of getters as well.
+ *
+ * Const objects are evaluated only through const getters and data members,
+ * while non-const getters give an empty value for them.
  */
 template< typename C >
 struct field : field_base
@@ -89,7 +108,8 @@ struct field : field_base
     template< typename R >
     field( std::string_view const name, R ( C::*m )() ) noexcept : field_base{ name }
     {
-        get = [ m ]( C && obj )
+        // converting in place keeps references returned by the getter, so strings are not copied
+        get = [ m ]( C && obj ) -> utils::any_value
         {
             return ( obj.*m )();
         };
@@ -98,16 +118,39 @@ struct field : field_base
     template< typename R >
     field( std::string_view const name, R ( C::*m )() const ) noexcept : field_base{ name }
     {
-        get = [ m ]( C && obj )
+        // converting in place keeps references returned by the getter, so strings are not copied
+        get_const = [ m ]( C const & obj ) -> utils::any_value
+        {
+            return ( obj.*m )();
+        };
+        get = [ m ]( C && obj ) -> utils::any_value
         {
             return ( obj.*m )();
         };
     }
 
+    template
+    <
+        typename R,
+        typename std::enable_if_t< !std::is_function_v< R > >* = nullptr
+    >
+    field( std::string_view const name, R C::*m ) noexcept : field_base{ name }
+    {
+        get_const = [ m ]( C const & obj ) -> utils::any_value
+        {
+            return obj.*m;
+        };
+        get = [ m ]( C && obj ) -> utils::any_value
+        {
+            return obj.*m;
+        };
+    }
+
     field & operator=( field       && rhs ) = default;
     field & operator=( field const  & rhs ) = default;
 
-    std::function< utils::any_value( C && ) > get{ nullptr };
+    std::function< utils::any_value( C && )      > get      { nullptr };
+    std::function< utils::any_value( C const & ) > get_const{ nullptr };
 };
 
 template< typename C, typename R >
@@ -116,6 +159,17 @@ auto make_field( std::string_view const name, R( C::*m )() const ) noexcept
     return new field< C >( name, m );
 }
 
+template
+<
+    typename C,
+    typename R,
+    typename std::enable_if_t< !std::is_function_v< R > >* = nullptr
+>
+auto make_field( std::string_view const name, R C::*m ) noexcept
+{
+    return new field< C >( name, m );
+}
+
 } // namespace booleval
 
 #endif // BOOLEVAL_FIELD_HPP
@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef BOOLEVAL_PARALLEL_FILTER_HPP
+#define BOOLEVAL_PARALLEL_FILTER_HPP
+
+#include <vector>
+#include <cstdint>
+#include <numeric>
+#include <algorithm>
+#include <type_traits>
+
+#include <booleval/thread_pool.hpp>
+#include <booleval/utils/bitmap.hpp>
+
+namespace booleval
+{
+
+/**
+ * Default number of the objects evaluated by one task of the parallel filter.
+ */
+constexpr std::size_t parallel_chunk_size{ 65536u };
+
+namespace internal
+{
+
+    /**
+     * @class chunk
+     *
+     * Represents the view of the contiguous objects of one task.
+     */
+    template< typename T >
+    class chunk
+    {
+    public:
+        constexpr chunk( T const * const data, std::size_t const size ) noexcept
+            : data_{ data }
+            , size_{ size }
+        {}
+
+        [[ nodiscard ]] constexpr T const * data() const noexcept { return data_; }
+        [[ nodiscard ]] constexpr std::size_t size() const noexcept { return size_; }
+
+    private:
+        T const *   data_{ nullptr };
+        std::size_t size_{ 0u      };
+    };
+
+    /**
+     * Evaluates the expression for each chunk of the objects on the thread pool, one chunk
+     * per task, and calls the function with the chunk number and the selection of its objects.
+     */
+    template< typename Range, typename Expression, typename F >
+    void parallel_evaluate( Range const & objects, Expression const & expression, thread_pool & pool, std::size_t const chunk_size, F && f )
+    {
+        auto const   size  { std::size( objects ) };
+        auto const * first { std::data( objects ) };
+        auto const   step  { std::max< std::size_t >( chunk_size, 1u ) };
+        auto const   chunks{ ( size + step - 1u ) / step };
+
+        using value_type = std::remove_cv_t< std::remove_pointer_t< decltype( first ) > >;
+
+        pool.for_each
+        (
+            chunks,
+            [ & ]( std::size_t const index )
+            {
+                auto const begin{ index * step };
+                chunk< value_type > const part{ first + begin, std::min( step, size - begin ) };
+
+                utils::bitmap selection{};
+                expression.evaluate_batch( part, selection );
+
+                f( index, selection );
+            }
+        );
+    }
+
+} // namespace internal
+
+/**
+ * Evaluates the expression for the objects stored contiguously, e.g. in the vector, using
+ * all the threads of the thread pool. Objects are split into chunks, each of them evaluated
+ * at once by one task. Expression is evaluated by multiple threads at the same time, so it
+ * has to be the compiled expression rather than the evaluator.
+ *
+ * @param objects    Objects to be evaluated
+ * @param expression Expression shared by all the threads
+ * @param pool       Thread pool
+ * @param chunk_size Number of the objects evaluated by one task
+ *
+ * @return Indices of the objects satisfying the expression, in ascending order
+ */
+template< typename Range, typename Expression >
+[[ nodiscard ]] std::vector< std::size_t > parallel_filter
+(
+    Range       const & objects,
+    Expression  const & expression,
+    thread_pool       & pool,
+    std::size_t const   chunk_size = parallel_chunk_size
+)
+{
+    auto const step{ std::max< std::size_t >( chunk_size, 1u ) };
+    std::vector< std::vector< std::size_t > > selected( ( std::size( objects ) + step - 1u ) / step );
+
+    internal::parallel_evaluate
+    (
+        objects,
+        expression,
+        pool,
+        step,
+        [ &selected, step ]( std::size_t const index, utils::bitmap const & selection )
+        {
+            auto & indices{ selected[ index ] };
+            selection.indices( indices );
+
+            for ( auto & i : indices ) { i += index * step; }
+        }
+    );
+
+    // chunks are merged in their order, so the indices stay sorted
+    std::vector< std::size_t > result;
+    result.reserve
+    (
+        std::accumulate
+        (
+            std::cbegin( selected ),
+            std::cend  ( selected ),
+            std::size_t{ 0u },
+            []( std::size_t const sum, auto const & indices ) noexcept
+            {
+                return sum + std::size( indices );
+            }
+        )
+    );
+
+    for ( auto const & indices : selected )
+    {
+        result.insert( std::end( result ), std::cbegin( indices ), std::cend( indices ) );
+    }
+
+    return result;
+}
+
+/**
+ * Evaluates the expression for the objects stored contiguously on the thread pool
+ * created only for this call.
+ *
+ * @param objects    Objects to be evaluated
+ * @param expression Expression shared by all the threads
+ * @param threads    Number of the threads
+ *
+ * @return Indices of the objects satisfying the expression, in ascending order
+ */
+template< typename Range, typename Expression >
+[[ nodiscard ]] std::vector< std::size_t > parallel_filter
+(
+    Range       const & objects,
+    Expression  const & expression,
+    std::size_t const   threads
+)
+{
+    thread_pool pool{ threads };
+    return parallel_filter( objects, expression, pool );
+}
+
+/**
+ * Counts the objects satisfying the expression using all the threads of the thread pool.
+ *
+ * @param objects    Objects to be evaluated
+ * @param expression Expression shared by all the threads
+ * @param pool       Thread pool
+ * @param chunk_size Number of the objects evaluated by one task
+ *
+ * @return Number of the objects satisfying the expression
+ */
+template< typename Range, typename Expression >
+[[ nodiscard ]] std::size_t parallel_count
+(
+    Range       const & objects,
+    Expression  const & expression,
+    thread_pool       & pool,
+    std::size_t const   chunk_size = parallel_chunk_size
+)
+{
+    auto const step{ std::max< std::size_t >( chunk_size, 1u ) };
+    std::vector< std::size_t > counts( ( std::size( objects ) + step - 1u ) / step );
+
+    internal::parallel_evaluate
+    (
+        objects,
+        expression,
+        pool,
+        step,
+        [ &counts ]( std::size_t const index, utils::bitmap const & selection ) noexcept
+        {
+            counts[ index ] = selection.count();
+        }
+    );
+
+    return std::accumulate( std::cbegin( counts ), std::cend( counts ), std::size_t{ 0u } );
+}
+
+} // namespace booleval
+
+#endif // BOOLEVAL_PARALLEL_FILTER_HPP
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef BOOLEVAL_THREAD_POOL_HPP
+#define BOOLEVAL_THREAD_POOL_HPP
+
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+#include <condition_variable>
+
+namespace booleval
+{
+
+/**
+ * @class thread_pool
+ *
+ * Represents the pool of worker threads running the tasks numbered from zero up to the number
+ * of the tasks. Tasks are split into contiguous ranges, one per worker, and each worker runs its
+ * own tasks from the front of its queue. Worker running out of its own tasks steals the tasks
+ * from the back of the queues of the other workers, so the workers finishing early take over
+ * the work of the slow ones.
+ */
+class thread_pool
+{
+public:
+    /**
+     * Starts the worker threads.
+     *
+     * @param threads Number of the worker threads, at least one
+     */
+    explicit thread_pool( std::size_t const threads = std::thread::hardware_concurrency() )
+    {
+        auto const count{ std::max< std::size_t >( threads, 1u ) };
+
+        for ( std::size_t i{ 0u }; i < count; ++i )
+        {
+            queues_.push_back( std::make_unique< queue >() );
+        }
+
+        for ( std::size_t i{ 0u }; i < count; ++i )
+        {
+            threads_.emplace_back( [ this, i ] { work( i ); } );
+        }
+    }
+
+    thread_pool( thread_pool       && rhs ) = delete;
+    thread_pool( thread_pool const  & rhs ) = delete;
+
+    thread_pool & operator=( thread_pool       && rhs ) = delete;
+    thread_pool & operator=( thread_pool const  & rhs ) = delete;
+
+    ~thread_pool()
+    {
+        {
+            std::lock_guard< std::mutex > const lock{ mutex_ };
+            stop_ = true;
+        }
+
+        wake_.notify_all();
+
+        for ( auto & thread : threads_ ) { thread.join(); }
+    }
+
+    /**
+     * Gets the number of the worker threads.
+     *
+     * @return Number of the worker threads
+     */
+    [[ nodiscard ]] std::size_t size() const noexcept
+    {
+        return std::size( threads_ );
+    }
+
+    /**
+     * Runs the function for each task and waits until all the tasks are run.
+     * Calls from multiple threads at the same time are run one after another.
+     *
+     * @param tasks    Number of the tasks
+     * @param function Function called with the task number, must not throw
+     */
+    void for_each( std::size_t const tasks, std::function< void( std::size_t ) > const & function )
+    {
+        if ( tasks == 0u ) { return; }
+
+        std::lock_guard< std::mutex > const submit{ submit_ };
+
+        function_  = &function;
+        remaining_ = tasks;
+
+        auto const workers{ std::size( queues_ ) };
+        for ( std::size_t i{ 0u }; i < workers; ++i )
+        {
+            std::lock_guard< std::mutex > const lock{ queues_[ i ]->mutex };
+            for ( auto task{ tasks * i / workers }; task < tasks * ( i + 1u ) / workers; ++task )
+            {
+                queues_[ i ]->tasks.push_back( task );
+            }
+        }
+
+        std::unique_lock< std::mutex > lock{ mutex_ };
+        ++generation_;
+        wake_.notify_all();
+        done_.wait( lock, [ this ] { return remaining_ == 0u; } );
+    }
+
+private:
+    /**
+     * @struct queue
+     *
+     * Represents the queue of the tasks of one worker.
+     */
+    struct queue
+    {
+        std::mutex                mutex{};
+        std::deque< std::size_t > tasks{};
+    };
+
+    /**
+     * Takes the next task, either from the front of the own queue or from the back of the other ones.
+     */
+    [[ nodiscard ]] bool take( std::size_t const worker, std::size_t & task )
+    {
+        auto const workers{ std::size( queues_ ) };
+
+        for ( std::size_t i{ 0u }; i < workers; ++i )
+        {
+            auto & q{ *queues_[ ( worker + i ) % workers ] };
+
+            std::lock_guard< std::mutex > const lock{ q.mutex };
+            if ( q.tasks.empty() ) { continue; }
+
+            if ( i == 0u )
+            {
+                task = q.tasks.front();
+                q.tasks.pop_front();
+            }
+            else
+            {
+                task = q.tasks.back();
+                q.tasks.pop_back();
+            }
+
+            return true;
+        }
+
+        return false;
+    }
+
+    void work( std::size_t const worker )
+    {
+        std::uint64_t seen{ 0u };
+
+        for ( ;; )
+        {
+            {
+                std::unique_lock< std::mutex > lock{ mutex_ };
+                wake_.wait( lock, [ this, seen ] { return stop_ || generation_ != seen; } );
+
+                if ( stop_ ) { return; }
+                seen = generation_;
+            }
+
+            // function is published before the tasks, whose queue mutex orders the two
+            for ( std::size_t task{ 0u }; take( worker, task ); )
+            {
+                ( *function_ )( task );
+
+                std::lock_guard< std::mutex > const lock{ mutex_ };
+                if ( --remaining_ == 0u ) { done_.notify_all(); }
+            }
+        }
+    }
+
+private:
+    std::vector< std::unique_ptr< queue > >      queues_    {};
+    std::vector< std::thread >                   threads_   {};
+    std::mutex                                   submit_    {};
+    std::mutex                                   mutex_     {};
+    std::condition_variable                      wake_      {};
+    std::condition_variable                      done_      {};
+    std::function< void( std::size_t ) > const * function_  { nullptr };
+    std::size_t                                  remaining_ { 0u };
+    std::uint64_t                                generation_{ 0u };
+    bool                                         stop_      { false };
+};
+
+} // namespace booleval
+
+#endif // BOOLEVAL_THREAD_POOL_HPP
@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef BOOLEVAL_LEXER_HPP
+#define BOOLEVAL_LEXER_HPP
+
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <string_view>
+
+#include <booleval/token/token.hpp>
+#include <booleval/token/token_type_utils.hpp>
+#include <booleval/utils/string_utils.hpp>
+#include <booleval/utils/split_options.hpp>
+#include <booleval/utils/split_range.hpp>
+
+namespace booleval::token
+{
+
+namespace internal
+{
+
+    inline constexpr auto delimiter_symbols{ get_delimiter_symbols() };
+
+    inline constexpr auto split_options
+    {
+        utils::split_options::include_delimiters  |
+        utils::split_options::split_by_whitespace |
+        utils::split_options::allow_quoted_strings |
+        utils::split_options::vectorized
+    };
+
+    using split_range = utils::split_range< split_options >;
+
+} // namespace internal
+
+/**
+ * @class lexer
+ *
+ * Represents the lexer producing the tokens of the expression one by one on demand,
+ * i.e. the expression is split only as far as its tokens are requested, and tokens
+ * are not stored anywhere. Lexer keeps one token of lookahead that can be examined
+ * without consuming it.
+ *
+ * Negation keyword followed by 'in' keyword is merged into a single 'not in' token.
+ * Since equal to operator is optional, it is produced between two field tokens in a row,
+ * as well as between the field and the parameter.
+ *
+ * Comma separates the values only inside the set, i.e. between the parentheses following
+ * 'in' or 'not in' keyword. Anywhere else it is a part of the value, e.g. 'foo,bar'.
+ */
+class lexer
+{
+public:
+    /**
+     * Constructs the lexer of the expression. Expression is not copied, so it
+     * has to outlive the lexer and the tokens it produces.
+     *
+     * @param expression Expression to split into tokens
+     */
+    explicit lexer( std::string_view const expression ) noexcept
+        : current_{ internal::split_range{ expression, delimiters() }.begin() }
+        , end_    { internal::split_range{ expression, delimiters() }.end  () }
+    {}
+
+    /**
+     * Checks whether all the tokens of the expression are consumed.
+     *
+     * @return True if there are no more tokens, otherwise false
+     */
+    [[ nodiscard ]] bool empty() noexcept
+    {
+        return !fill();
+    }
+
+    /**
+     * Gets the next token without consuming it. Lexer must not be empty.
+     *
+     * @return Next token
+     */
+    [[ nodiscard ]] token const & peek() noexcept
+    {
+        fill();
+        return pending_[ first_ ];
+    }
+
+    /**
+     * Consumes the next token. Lexer must not be empty.
+     *
+     * @return Consumed token
+     */
+    token next() noexcept
+    {
+        fill();
+        --size_;
+        return pending_[ first_++ ];
+    }
+
+private:
+    [[ nodiscard ]] static constexpr std::string_view delimiters() noexcept
+    {
+        return { std::data( internal::delimiter_symbols ), std::size( internal::delimiter_symbols ) };
+    }
+
+    /**
+     * Splits the expression until at least one token is pending or the end of
+     * the expression is reached.
+     *
+     * @return True if there is a pending token, otherwise false
+     */
+    bool fill() noexcept
+    {
+        if ( size_ != 0u ) { return true; }
+
+        first_ = 0u;
+
+        while ( size_ == 0u && current_ != end_ )
+        {
+            auto [ is_quoted, value ]{ *current_ };
+            ++current_;
+
+            if ( utils::is_whitespace( value ) ) { continue; }
+
+            if ( !is_quoted && !in_set_ ) { value = join( value ); }
+
+            auto type{ is_quoted ? token_type::field : to_token_type( value ) };
+
+            // comma outside of the set is a value on its own, the same as any other text
+            if ( type == token_type::comma && !in_set_ ) { type = token_type::field; }
+
+            if ( !negation_.empty() )
+            {
+                if ( type == token_type::in )
+                {
+                    push( { token_type::not_in, to_token_keyword( token_type::not_in ) } );
+                    negation_ = {};
+                    continue;
+                }
+
+                push( { token_type::field, negation_ } );
+                negation_ = {};
+            }
+
+            if ( !is_quoted && is_negation( value ) )
+            {
+                negation_ = value;
+                continue;
+            }
+
+            push( { type, value } );
+        }
+
+        if ( size_ == 0u && !negation_.empty() )
+        {
+            push( { token_type::field, negation_ } );
+            negation_ = {};
+        }
+
+        return size_ != 0u;
+    }
+
+    /**
+     * Joins the value with the following parts of the expression adjacent to it, i.e. the ones
+     * split off only by the comma, so the value is not split by the comma outside of the set.
+     *
+     * @param value Value split off the expression
+     *
+     * @return Value together with its adjacent parts
+     */
+    std::string_view join( std::string_view value ) noexcept
+    {
+        if ( is_parenthesis( value ) ) { return value; }
+
+        while ( current_ != end_ )
+        {
+            auto const [ is_quoted, next ]{ *current_ };
+
+            auto const is_adjacent{ std::data( next ) == std::data( value ) + std::size( value ) };
+
+            if ( is_quoted || !is_adjacent || utils::is_whitespace( next ) || is_parenthesis( next ) ) { break; }
+
+            value = { std::data( value ), std::size( value ) + std::size( next ) };
+            ++current_;
+        }
+
+        return value;
+    }
+
+    [[ nodiscard ]] static constexpr bool is_parenthesis( std::string_view const value ) noexcept
+    {
+        return to_token_type( value ) == token_type::lp || to_token_type( value ) == token_type::rp;
+    }
+
+    /**
+     * Appends the token to the pending tokens, preceded by the implicit equal to operator if needed.
+     *
+     * @param token Token to append
+     */
+    void push( token const & token ) noexcept
+    {
+        if ( token.is_one_of( token_type::field, token_type::parameter ) && last_ == token_type::field )
+        {
+            pending_[ first_ + size_++ ] = { token_type::eq, to_token_keyword( token_type::eq ) };
+        }
+
+        if ( token.is( token_type::lp ) )
+        {
+            in_set_ = last_ == token_type::in || last_ == token_type::not_in;
+        }
+        else if ( token.is( token_type::rp ) )
+        {
+            in_set_ = false;
+        }
+
+        pending_[ first_ + size_++ ] = token;
+        last_ = token.type();
+    }
+
+private:
+    using iterator = decltype( std::declval< internal::split_range >().begin() );
+
+    iterator current_;
+    iterator end_;
+
+    // negation keyword waiting for the next token to find out whether it is a part of 'not in',
+    // empty if there is none
+    std::string_view negation_{};
+
+    // at most two tokens along with their implicit equal to operators are produced by a single split
+    std::array< token, 4 > pending_{};
+    std::uint8_t           first_  { 0u };
+    std::uint8_t           size_   { 0u };
+
+    token_type last_  { token_type::unknown };
+    bool       in_set_{ false };
+};
+
+} // namespace booleval::token
+
+#endif // BOOLEVAL_LEXER_HPP
@@ -38,7 +38,8 @@ namespace booleval::token
 /**
  * enum class token_type
  *
- * Represents a token type. Supported types are logical operators, relational operators, parentheses and field.
+ * Represents a token type. Supported types are logical operators, relational operators,
+ * set membership operators, parentheses, comma, field and parameter.
  */
 enum class [[ nodiscard ]] token_type : std::uint8_t
 {
@@ -72,11 +73,23 @@ enum class [[ nodiscard ]] token_type : std::uint8_t
     // 'Less than or equal to' relational operator token type
     leq,
 
+    // 'In' set membership operator token type
+    in,
+
+    // 'Not in' set membership operator token type
+    not_in,
+
     // Left parenthesis token type
     lp,
 
     // Right parenthesis token type
-    rp
+    rp,
+
+    // Comma separating the elements of a set
+    comma,
+
+    // Parameter whose value is bound after the expression is compiled
+    parameter
 };
 
 } // namespace booleval::token
@@ -32,6 +32,8 @@
 
 #include <array>
 #include <cassert>
+#include <cstdint>
+#include <cstddef>
 #include <utility>
 #include <string_view>
 
@@ -63,7 +65,19 @@ namespace internal
         token_type_pair{ "geq", token_type::geq         },
         token_type_pair{ "GEQ", token_type::geq         },
         token_type_pair{ "leq", token_type::leq         },
-        token_type_pair{ "LEQ", token_type::leq         }
+        token_type_pair{ "LEQ", token_type::leq         },
+        token_type_pair{ "in" , token_type::in          },
+        token_type_pair{ "IN" , token_type::in          },
+
+        // never produced by splitting the expression, the tokenizer merges 'not' followed by 'in'
+        token_type_pair{ "not in", token_type::not_in },
+        token_type_pair{ "NOT IN", token_type::not_in }
+    };
+
+    constexpr inline std::array negations
+    {
+        std::string_view{ "not" },
+        std::string_view{ "NOT" }
     };
 
     constexpr inline std::array symbols
@@ -77,9 +91,99 @@ namespace internal
         token_type_pair{ ">=", token_type::geq         },
         token_type_pair{ "<=", token_type::leq         },
         token_type_pair{ "(" , token_type::lp          },
-        token_type_pair{ ")" , token_type::rp          }
+        token_type_pair{ ")" , token_type::rp          },
+        token_type_pair{ "," , token_type::comma       },
+        token_type_pair{ "?" , token_type::parameter   }
     };
 
+    /**
+     * Number of bits of the slot of the lexeme table, i.e. the table has twice as many
+     * slots as there are keywords and symbols, so a collision free hash is found quickly.
+     */
+    constexpr inline std::uint32_t slot_bits{ 6u };
+
+    constexpr inline std::uint8_t empty_slot{ 0xFFu };
+
+    /**
+     * Hashes the lexeme by its length and its first and last characters, which are enough
+     * to tell all the keywords and symbols apart, into the slot of the lexeme table.
+     *
+     * @param value Non-empty lexeme
+     * @param seed  Odd multiplier
+     *
+     * @return Slot of the lexeme table
+     */
+    [[ nodiscard ]] constexpr std::size_t slot( std::string_view const value, std::uint32_t const seed ) noexcept
+    {
+        auto const key
+        {
+            static_cast< std::uint32_t >( std::size( value ) ) ^
+            static_cast< std::uint32_t >( static_cast< unsigned char >( value.front() ) ) << 8  ^
+            static_cast< std::uint32_t >( static_cast< unsigned char >( value.back () ) ) << 16
+        };
+
+        return static_cast< std::size_t >( ( key * seed ) >> ( 32u - slot_bits ) );
+    }
+
+    /**
+     * Gets all the keywords followed by all the symbols.
+     */
+    [[ nodiscard ]] constexpr auto get_lexemes() noexcept
+    {
+        std::array< token_type_pair, std::size( keywords ) + std::size( symbols ) > lexemes{};
+
+        std::size_t i{ 0u };
+        // std::pair is not assignable in constant expressions before C++20
+        auto append
+        {
+            [ & ]( token_type_pair const & lexeme ) noexcept
+            {
+                lexemes[ i   ].first  = lexeme.first;
+                lexemes[ i++ ].second = lexeme.second;
+            }
+        };
+
+        for ( auto && keyword : keywords ) { append( keyword ); }
+        for ( auto && symbol  : symbols  ) { append( symbol  ); }
+
+        return lexemes;
+    }
+
+    constexpr inline auto lexemes{ get_lexemes() };
+
+    static_assert( std::size( lexemes ) < ( 1u << slot_bits ) && std::size( lexemes ) < empty_slot, "Too many lexemes." );
+
+    /**
+     * Finds the lexeme table holding all the lexemes in distinct slots, i.e. the perfect hash.
+     * Table maps the slot to the index of the lexeme.
+     *
+     * @param seed Odd multiplier of the hash to try first
+     *
+     * @return Multiplier of the hash and the lexeme table
+     */
+    [[ nodiscard ]] constexpr auto get_lexeme_table( std::uint32_t seed ) noexcept
+    {
+        std::array< std::uint8_t, 1u << slot_bits > table{};
+
+        for ( ; ; seed += 2u )
+        {
+            for ( auto & index : table ) { index = empty_slot; }
+
+            auto collision{ false };
+            for ( std::size_t i{ 0u }; i < std::size( lexemes ) && !collision; ++i )
+            {
+                auto & index{ table[ slot( lexemes[ i ].first, seed ) ] };
+
+                collision = index != empty_slot;
+                index     = static_cast< std::uint8_t >( i );
+            }
+
+            if ( !collision ) { return std::pair{ seed, table }; }
+        }
+    }
+
+    constexpr inline auto lexeme_table{ get_lexeme_table( 0x9E3779B1u ) };
+
 } // namespace internal
 
 /**
@@ -125,46 +229,65 @@ namespace internal
 }
 
 /**
- * Maps token value to token type.
+ * Gets the symbols that split the expression even if they are not surrounded
+ * by whitespace characters, i.e. parentheses and comma.
+ *
+ * @return Delimiter symbols
+ */
+[[ nodiscard ]] constexpr auto get_delimiter_symbols() noexcept
+{
+    constexpr auto parentheses_symbols{ get_parentheses_symbols() };
+
+    std::array< char, std::size( parentheses_symbols ) + 1 > delimiter_symbols{};
+
+    for ( std::size_t i{ 0u }; i < std::size( parentheses_symbols ); ++i )
+    {
+        delimiter_symbols[ i ] = parentheses_symbols[ i ];
+    }
+
+    delimiter_symbols.back() = ',';
+
+    return delimiter_symbols;
+}
+
+/**
+ * Checks whether token value is the negation keyword preceding the 'in' keyword.
  *
  * @param value Token value
  *
- * @return Token type
+ * @return True if token value is the negation keyword, otherwise false
  */
-constexpr token_type to_token_type( std::string_view const value ) noexcept
+[[ nodiscard ]] constexpr bool is_negation( std::string_view const value ) noexcept
 {
-    auto find_matching
-    {
-        [ value ]( auto const & collection ) noexcept
+    return utils::find_if
+    (
+        std::cbegin( internal::negations ),
+        std::cend  ( internal::negations ),
+        [ value ]( auto && item ) noexcept
         {
-            return utils::find_if
-            (
-                std::cbegin( collection ),
-                std::cend  ( collection ),
-                [ value ]( auto && item )
-                {
-                    return item.first == value;
-                }
-            );
+            return item == value;
         }
-    };
+    ) != std::cend( internal::negations );
+}
 
-    if
-    (
-        auto const keyword{ find_matching( internal::keywords ) };
-        keyword != std::cend( internal::keywords )
-    )
-    {
-        return keyword->second;
-    }
+/**
+ * Maps token value to token type. Keywords and symbols are looked up in the perfect
+ * hash table, so any value is classified by a single probe and a single comparison.
+ *
+ * @param value Token value
+ *
+ * @return Token type
+ */
+constexpr token_type to_token_type( std::string_view const value ) noexcept
+{
+    if ( value.empty() ) { return token_type::field; }
 
-    if
-    (
-        auto const symbol{ find_matching( internal::symbols ) };
-        symbol != std::cend( internal::symbols )
-    )
+    auto const & [ seed, table ]{ internal::lexeme_table };
+
+    auto const index{ table[ internal::slot( value, seed ) ] };
+    if ( index != internal::empty_slot && internal::lexemes[ index ].first == value )
     {
-        return symbol->second;
+        return internal::lexemes[ index ].second;
     }
 
     return token_type::field;
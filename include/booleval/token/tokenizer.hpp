@@ -31,13 +31,10 @@
 #define BOOLEVAL_TOKENIZER_HPP
 
 #include <vector>
-#include <iostream>
 #include <string_view>
 
 #include <booleval/token/token.hpp>
-#include <booleval/utils/string_utils.hpp>
-#include <booleval/utils/split_options.hpp>
-#include <booleval/utils/split_range.hpp>
+#include <booleval/token/lexer.hpp>
 
 namespace booleval::token
 {
@@ -45,45 +42,15 @@ namespace booleval::token
 /**
  * Tokenizes given expression, i.e. transforms given expression
  * from string to the collection of token objects.
+ * Negation keyword followed by 'in' keyword is merged into a single 'not in' token.
  */
 inline std::vector< token > tokenize( std::string_view const expression ) noexcept
 {
     std::vector< token > result;
 
-    constexpr auto parentheses_symbols{ get_parentheses_symbols() };
-    constexpr auto split_options
+    for ( lexer lexer{ expression }; !lexer.empty(); )
     {
-        utils::split_options::include_delimiters  |
-        utils::split_options::split_by_whitespace |
-        utils::split_options::allow_quoted_strings
-    };
-
-    auto const delimiters
-    {
-        utils::join
-        (
-            std::cbegin( parentheses_symbols ),
-            std::cend  ( parentheses_symbols )
-        )
-    };
-
-    auto const tokens_range{ utils::split_range< split_options >( expression, delimiters ) };
-
-    for ( auto const [ is_quoted, value ] : tokens_range )
-    {
-        if ( utils::is_whitespace( value ) ) { continue; }
-
-        auto const type{ is_quoted ? token_type::field : to_token_type( value ) };
-
-        if ( type == token_type::field )
-        {
-            if ( !result.empty() && result.back().is( token_type::field ) )
-            {
-                result.emplace_back( token_type::eq, to_token_keyword( token_type::eq ) );
-            }
-        }
-
-        result.emplace_back( type, value );
+        result.push_back( lexer.next() );
     }
 
     return result;
@@ -0,0 +1,387 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef BOOLEVAL_ARENA_HPP
+#define BOOLEVAL_ARENA_HPP
+
+#include <vector>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+
+#include <booleval/tree/node.hpp>
+#include <booleval/token/token.hpp>
+#include <booleval/token/token_type.hpp>
+
+namespace booleval::tree
+{
+
+/**
+ * @class node_span
+ *
+ * Represents the view of the contiguous list of node indices stored in the arena.
+ */
+class node_span
+{
+public:
+    constexpr node_span() noexcept = default;
+
+    constexpr node_span( node_index const * first, std::size_t const size ) noexcept
+        : first_{ first }
+        , size_ { size  }
+    {}
+
+    [[ nodiscard ]] constexpr node_index const * begin() const noexcept { return first_;         }
+    [[ nodiscard ]] constexpr node_index const * end  () const noexcept { return first_ + size_; }
+
+    [[ nodiscard ]] constexpr std::size_t size () const noexcept { return size_;       }
+    [[ nodiscard ]] constexpr bool        empty() const noexcept { return size_ == 0u; }
+
+    [[ nodiscard ]] constexpr node_index operator[]( std::size_t const index ) const noexcept { return first_[ index ]; }
+
+private:
+    node_index const * first_{ nullptr };
+    std::size_t        size_ { 0u      };
+};
+
+/**
+ * @class arena
+ *
+ * Represents the contiguous storage of all the nodes of one expression tree.
+ * Nodes are laid out in evaluation order, i.e. child nodes always precede their
+ * parent node, while the root node is the last one. Arena also keeps its own copy
+ * of the expression text so token values of the nodes are stored as plain offsets.
+ * The text is kept in the heap storage that moves together with the arena, so the
+ * views into the text (e.g. the ones held by the compiled program) stay valid when
+ * the arena is moved, but not when it is copied.
+ *
+ * Nodes having a variable number of children (e.g. the elements of a set or the
+ * operands of a logical operation) do not store them in the node itself. Instead,
+ * the indices of the children are stored contiguously into the extra storage of
+ * the arena, while the node stores the offset and length of that list.
+ *
+ * Parameters are numbered in the order of their appearance in the expression and
+ * the number of the parameter is stored as the offset of its node.
+ *
+ * Clearing the arena keeps the allocated storage, so building a new expression
+ * tree into the same arena does not allocate once the storage is large enough.
+ */
+class arena
+{
+public:
+    using const_iterator = std::vector< node >::const_iterator;
+
+    arena() = default;
+
+    arena( arena       && rhs ) = default;
+    arena( arena const  & rhs ) = default;
+
+    arena & operator=( arena       && rhs ) = default;
+    arena & operator=( arena const  & rhs ) = default;
+
+    ~arena() = default;
+
+    /**
+     * Removes all the nodes and the text while keeping the allocated storage.
+     */
+    void clear() noexcept
+    {
+        text_ .clear();
+        nodes_.clear();
+        extra_.clear();
+        root_       = null_node;
+        parameters_ = 0u;
+    }
+
+    /**
+     * Sets the expression text that token values are referring to.
+     *
+     * @param text Expression text
+     *
+     * @return Arena's copy of the expression text
+     */
+    std::string_view text( std::string_view const text )
+    {
+        text_.assign( std::begin( text ), std::end( text ) );
+        return { std::data( text_ ), std::size( text_ ) };
+    }
+
+    /**
+     * Gets the expression text that token values are referring to.
+     *
+     * @return Expression text
+     */
+    [[ nodiscard ]] std::string_view text() const noexcept
+    {
+        return { std::data( text_ ), std::size( text_ ) };
+    }
+
+    /**
+     * Appends the node representing the specified token. Value of the field token is
+     * stored as the offset into the arena's text. If the value is not a part of the
+     * arena's text, it gets appended to it. Parameter token gets the next parameter number.
+     *
+     * @param token Token the node represents
+     * @param left  Index of the left child node
+     * @param right Index of the right child node
+     *
+     * @return Index of the appended node
+     */
+    node_index emplace
+    (
+        token::token const & token,
+        node_index   const   left  = null_node,
+        node_index   const   right = null_node
+    )
+    {
+        node n{ token.type(), left, right };
+
+        if ( token.is( token::token_type::field ) )
+        {
+            auto const value{ token.value() };
+            auto const first{ std::data( text_ ) };
+            auto const last { first + std::size( text_ ) };
+
+            std::less< char const * > const less{};
+            if ( less( std::data( value ), first ) || less( last, std::data( value ) + std::size( value ) ) )
+            {
+                n.offset = static_cast< std::uint32_t >( std::size( text_ ) );
+                text_.insert( std::end( text_ ), std::begin( value ), std::end( value ) );
+            }
+            else
+            {
+                n.offset = static_cast< std::uint32_t >( std::data( value ) - first );
+            }
+
+            n.length = static_cast< std::uint32_t >( std::size( value ) );
+        }
+        else if ( token.is( token::token_type::parameter ) )
+        {
+            n.offset = parameters_++;
+        }
+
+        nodes_.push_back( n );
+        return static_cast< node_index >( std::size( nodes_ ) - 1 );
+    }
+
+    /**
+     * Appends the node of the specified token type. Logical operation gets
+     * both child nodes as its operands in the extra storage.
+     *
+     * @param type  Token type the node represents
+     * @param left  Index of the left child node
+     * @param right Index of the right child node
+     *
+     * @return Index of the appended node
+     */
+    node_index emplace
+    (
+        token::token_type const type,
+        node_index        const left  = null_node,
+        node_index        const right = null_node
+    )
+    {
+        if ( node{ type }.is_logical() && left != null_node && right != null_node )
+        {
+            auto const first{ extra_size() };
+            extra( left  );
+            extra( right );
+            return emplace_list( type, first );
+        }
+
+        nodes_.emplace_back( type, left, right );
+        return static_cast< node_index >( std::size( nodes_ ) - 1 );
+    }
+
+    /**
+     * Appends the copy of the specified node, e.g. the one of another arena
+     * holding the same expression text. Offset and length are kept as they are.
+     *
+     * @param n Node to copy
+     *
+     * @return Index of the appended node
+     */
+    node_index emplace( node const & n )
+    {
+        if ( n.type == token::token_type::parameter && n.offset >= parameters_ )
+        {
+            parameters_ = n.offset + 1u;
+        }
+
+        nodes_.push_back( n );
+        return static_cast< node_index >( std::size( nodes_ ) - 1 );
+    }
+
+    /**
+     * Appends the node index to the extra storage. Indices appended in a row
+     * become the children of the node created by emplace_list.
+     *
+     * @param index Node index
+     */
+    void extra( node_index const index )
+    {
+        extra_.push_back( index );
+    }
+
+    /**
+     * Gets the number of the node indices in the extra storage. Used to mark
+     * the beginning of the list before its elements are appended.
+     *
+     * @return Size of the extra storage
+     */
+    [[ nodiscard ]] std::uint32_t extra_size() const noexcept
+    {
+        return static_cast< std::uint32_t >( std::size( extra_ ) );
+    }
+
+    /**
+     * Appends the node whose children are the node indices of the extra storage
+     * starting at the specified position up to the end of the extra storage.
+     *
+     * @param type  Token type the node represents
+     * @param first Position of the first child within the extra storage
+     *
+     * @return Index of the appended node
+     */
+    node_index emplace_list( token::token_type const type, std::uint32_t const first )
+    {
+        node n{ type };
+        n.offset = first;
+        n.length = extra_size() - first;
+
+        nodes_.push_back( n );
+        return static_cast< node_index >( std::size( nodes_ ) - 1 );
+    }
+
+    /**
+     * Gets the children of the node created by emplace_list, e.g. the elements
+     * of the set or the operands of the logical operation.
+     *
+     * @param n Node
+     *
+     * @return Child node indices
+     */
+    [[ nodiscard ]] node_span list( node const & n ) const noexcept
+    {
+        return { std::data( extra_ ) + n.offset, n.length };
+    }
+
+    /**
+     * Gets the node at the specified index.
+     *
+     * @param index Node index
+     *
+     * @return Node
+     */
+    [[ nodiscard ]] node const & operator[]( node_index const index ) const noexcept
+    {
+        return nodes_[ index ];
+    }
+
+    [[ nodiscard ]] node & operator[]( node_index const index ) noexcept
+    {
+        return nodes_[ index ];
+    }
+
+    /**
+     * Gets the token value of the specified node.
+     *
+     * @param n Node
+     *
+     * @return Token value
+     */
+    [[ nodiscard ]] std::string_view value( node const & n ) const noexcept
+    {
+        if ( n.type == token::token_type::field )
+        {
+            return text().substr( n.offset, n.length );
+        }
+
+        return token::to_token_keyword( n.type );
+    }
+
+    /**
+     * Gets the token of the specified node.
+     *
+     * @param n Node
+     *
+     * @return Token
+     */
+    [[ nodiscard ]] token::token token( node const & n ) const noexcept
+    {
+        return { n.type, value( n ) };
+    }
+
+    /**
+     * Sets the root node.
+     *
+     * @param index Index of the root node
+     */
+    void root( node_index const index ) noexcept
+    {
+        root_ = index;
+    }
+
+    /**
+     * Gets the index of the root node.
+     *
+     * @return Index of the root node or null node if the arena is empty
+     */
+    [[ nodiscard ]] node_index root() const noexcept
+    {
+        return root_;
+    }
+
+    /**
+     * Gets the number of the parameters of the expression.
+     *
+     * @return Number of the parameters
+     */
+    [[ nodiscard ]] std::uint32_t parameters() const noexcept
+    {
+        return parameters_;
+    }
+
+    [[ nodiscard ]] std::size_t size() const noexcept { return std::size( nodes_ ); }
+    [[ nodiscard ]] bool       empty() const noexcept { return root_ == null_node; }
+
+    [[ nodiscard ]] const_iterator begin() const noexcept { return std::cbegin( nodes_ ); }
+    [[ nodiscard ]] const_iterator end  () const noexcept { return std::cend  ( nodes_ ); }
+
+private:
+    std::vector< char       > text_      {};
+    std::vector< node       > nodes_     {};
+    std::vector< node_index > extra_     {};
+    node_index                root_      { null_node };
+    std::uint32_t             parameters_{ 0u };
+};
+
+} // namespace booleval::tree
+
+#endif // BOOLEVAL_ARENA_HPP
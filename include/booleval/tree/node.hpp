@@ -30,41 +30,87 @@
 #ifndef BOOLEVAL_NODE_HPP
 #define BOOLEVAL_NODE_HPP
 
-#include <memory>
+#include <limits>
+#include <cstdint>
 
-#include <booleval/token/token.hpp>
 #include <booleval/token/token_type.hpp>
 
 namespace booleval::tree
 {
 
+/**
+ * Index of the node within the arena the node belongs to.
+ */
+using node_index = std::uint32_t;
+
+/**
+ * Index representing a missing node.
+ */
+constexpr node_index null_node{ std::numeric_limits< node_index >::max() };
+
 /**
  * struct node
  *
- * Represents the tree node containing references to left and right child nodes
- * as well as the token that the node represents in the actual expression tree.
+ * Represents the tree node containing indices of left and right child nodes
+ * as well as the type of the token that the node represents in the actual expression tree.
+ * Token value is not stored in the node itself but in the text of the arena, at the
+ * position described by the offset and length.
+ *
+ * Logical operations do not use the left and right child nodes. Instead, they keep any
+ * number of operands in the extra storage of the arena, at the position described by the
+ * offset and length, so the chains like 'a or b or c' are represented by a single node.
  */
 struct node
 {
-    token::token token{ token::token_type::unknown };
-
-    std::unique_ptr< node > left { nullptr };
-    std::unique_ptr< node > right{ nullptr };
+    token::token_type type  { token::token_type::unknown };
+    std::uint32_t     offset{ 0u                         };
+    std::uint32_t     length{ 0u                         };
+    node_index        left  { null_node                  };
+    node_index        right { null_node                  };
 
     constexpr node() noexcept = default;
 
-    node( node       && rhs ) noexcept = default;
-    node( node const  & rhs ) noexcept = delete;
+    constexpr node( node       && rhs ) noexcept = default;
+    constexpr node( node const  & rhs ) noexcept = default;
 
-    constexpr node( token::token_type const   type  ) noexcept : token( type  ) {}
-    constexpr node( token::token      const & token ) noexcept : token( token ) {}
+    constexpr node
+    (
+        token::token_type const type,
+        node_index        const left  = null_node,
+        node_index        const right = null_node
+    ) noexcept
+        : type ( type  )
+        , left ( left  )
+        , right( right )
+    {}
 
     node & operator=( node       && rhs ) noexcept = default;
-    node & operator=( node const  & rhs ) noexcept = delete;
+    node & operator=( node const  & rhs ) noexcept = default;
 
     ~node() noexcept = default;
+
+    /**
+     * Checks whether the node represents one of logical operations.
+     *
+     * @return True if the node represents logical operation, false otherwise
+     */
+    [[ nodiscard ]] constexpr bool is_logical() const noexcept
+    {
+        return type == token::token_type::logical_and || type == token::token_type::logical_or;
+    }
+
+    /**
+     * Checks whether the node has both child nodes, or at least one operand
+     * in case of the logical operation.
+     *
+     * @return True if the child nodes are present, false otherwise
+     */
+    [[ nodiscard ]] constexpr bool has_children() const noexcept
+    {
+        return is_logical() ? length != 0u : left != null_node && right != null_node;
+    }
 };
 
 } // namespace booleval::tree
 
-#endif // BOOLEVAL_NODE_HPP
\ No newline at end of file
+#endif // BOOLEVAL_NODE_HPP
@@ -0,0 +1,380 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef BOOLEVAL_OPTIMIZER_HPP
+#define BOOLEVAL_OPTIMIZER_HPP
+
+#include <vector>
+#include <cstdint>
+#include <iterator>
+#include <algorithm>
+#include <string_view>
+#include <unordered_map>
+
+#include <booleval/tree/node.hpp>
+#include <booleval/tree/arena.hpp>
+#include <booleval/token/token_type.hpp>
+
+namespace booleval::tree
+{
+
+namespace internal
+{
+
+    /**
+     * Gets the relational operation that the chain of the specified logical operation
+     * folds into the set membership operation, i.e. 'eq' for 'or' and 'neq' for 'and'.
+     */
+    [[ nodiscard ]] inline token::token_type foldable( token::token_type const type ) noexcept
+    {
+        return type == token::token_type::logical_or ? token::token_type::eq : token::token_type::neq;
+    }
+
+    /**
+     * Gets the set membership operation that the chain of the specified logical operation
+     * folds into, i.e. 'in' for 'or' and 'not in' for 'and'.
+     */
+    [[ nodiscard ]] inline token::token_type folded( token::token_type const type ) noexcept
+    {
+        return type == token::token_type::logical_or ? token::token_type::in : token::token_type::not_in;
+    }
+
+    /**
+     * Copies the relational or the set membership operation together with its operands.
+     */
+    inline node_index copy_relational( arena const & source, node const & node, arena & target )
+    {
+        auto const left{ target.emplace( source[ node.left ] ) };
+
+        if ( node.type != token::token_type::in && node.type != token::token_type::not_in )
+        {
+            return target.emplace( node.type, left, target.emplace( source[ node.right ] ) );
+        }
+
+        auto const first{ target.extra_size() };
+
+        for ( auto const element : source.list( source[ node.right ] ) )
+        {
+            target.extra( target.emplace( source[ element ] ) );
+        }
+
+        return target.emplace( node.type, left, target.emplace_list( token::token_type::lp, first ) );
+    }
+
+    /**
+     * Creates the set membership operation out of the operands of the logical chain
+     * testing the same field. Elements of the set keep the order of the operands.
+     */
+    inline node_index fold
+    (
+        arena             const & source,
+        node_span         const   operands,
+        token::token_type const   type,
+        arena                   & target
+    )
+    {
+        auto const left { target.emplace( source[ source[ operands[ 0 ] ].left ] ) };
+        auto const first{ target.extra_size() };
+
+        for ( auto const operand : operands )
+        {
+            auto const & node{ source[ operand ] };
+
+            if ( node.type == type )
+            {
+                for ( auto const element : source.list( source[ node.right ] ) )
+                {
+                    target.extra( target.emplace( source[ element ] ) );
+                }
+            }
+            else
+            {
+                target.extra( target.emplace( source[ node.right ] ) );
+            }
+        }
+
+        return target.emplace( type, left, target.emplace_list( token::token_type::lp, first ) );
+    }
+
+    [[ nodiscard ]] inline bool is_logical( arena const & source, node_index const index ) noexcept
+    {
+        if ( index == null_node || !source[ index ].has_children() ) { return false; }
+
+        auto const type{ source[ index ].type };
+        return type == token::token_type::logical_and || type == token::token_type::logical_or;
+    }
+
+    /**
+     * Copies the operand that is not a logical operation, i.e. the node without children
+     * or the relational operation.
+     */
+    inline node_index copy_operand( arena const & source, node_index const index, arena & target )
+    {
+        if ( index == null_node ) { return null_node; }
+
+        auto const & node{ source[ index ] };
+
+        if ( !node.has_children() )
+        {
+            return target.emplace( node );
+        }
+
+        return copy_relational( source, node, target );
+    }
+
+    /**
+     * Operand of the logical operation to be optimized, either on its own or, if the count
+     * is not zero, together with the rest of its group folded into one set membership operation.
+     */
+    struct logical_task
+    {
+        node_index    operand{ null_node };
+        std::uint32_t first  { 0u        };
+        std::uint32_t count  { 0u        };
+    };
+
+    /**
+     * Logical operation being optimized along with the range of its tasks on the task stack,
+     * the next task to be done and the position of its first result on the results stack.
+     */
+    struct logical_frame
+    {
+        token::token_type type   { token::token_type::unknown };
+        std::size_t       first  { 0u                         };
+        std::size_t       next   { 0u                         };
+        std::size_t       last   { 0u                         };
+        std::size_t       results{ 0u                         };
+        std::size_t       grouped{ 0u                         };
+    };
+
+    /**
+     * Optimizes the node by using the explicit stack of logical operations instead of the
+     * native call stack, so the nesting depth of the expression is not limited by the stack size.
+     *
+     * Maximal chain of the same logical operations, regardless of the parentheses, e.g.
+     * 'a or (b or c) or d', is optimized into the single logical operation node. Operands testing
+     * the equality of the same field with 'or', or the inequality of the same field with 'and', are
+     * folded into one set membership operation placed instead of the first of them. Other operands
+     * are optimized on their own.
+     */
+    inline node_index optimize_node( arena const & source, node_index const index, arena & target )
+    {
+        if ( !is_logical( source, index ) ) { return copy_operand( source, index, target ); }
+
+        std::vector< logical_frame > frames {};
+        std::vector< logical_task  > tasks  {};
+        std::vector< node_index    > grouped{};
+        std::vector< node_index    > results{};
+
+        // scratch storage reused by all the logical operations
+        std::vector< node_index > operands{};
+        std::vector< node_index > pending {};
+        std::unordered_map< std::string_view, std::vector< node_index > > groups{};
+
+        // parameters are not folded, since their values are bound separately
+        auto const is_constant
+        {
+            [ & ]( node_index const element ) noexcept
+            {
+                return source[ element ].type == token::token_type::field;
+            }
+        };
+
+        auto const is_foldable
+        {
+            [ & ]( node_index const operand, token::token_type const type ) noexcept
+            {
+                if ( operand == null_node || !source[ operand ].has_children() ) { return false; }
+
+                auto const & node{ source[ operand ] };
+
+                if ( node.type == foldable( type ) ) { return is_constant( node.right ); }
+
+                if ( node.type == folded( type ) )
+                {
+                    auto const elements{ source.list( source[ node.right ] ) };
+                    return std::all_of( std::begin( elements ), std::end( elements ), is_constant );
+                }
+
+                return false;
+            }
+        };
+
+        auto const call
+        {
+            [ & ]( node_index const current )
+            {
+                auto const type{ source[ current ].type };
+
+                operands.clear();
+                pending.assign( 1u, current );
+
+                while ( !pending.empty() )
+                {
+                    auto const operand{ pending.back() };
+                    pending.pop_back();
+
+                    if ( operand != null_node && source[ operand ].has_children() && source[ operand ].type == type )
+                    {
+                        auto const children{ source.list( source[ operand ] ) };
+                        pending.insert( std::end( pending ), std::make_reverse_iterator( std::end( children ) ), std::make_reverse_iterator( std::begin( children ) ) );
+                    }
+                    else
+                    {
+                        operands.push_back( operand );
+                    }
+                }
+
+                for ( auto const operand : operands )
+                {
+                    if ( is_foldable( operand, type ) )
+                    {
+                        groups[ source.value( source[ source[ operand ].left ] ) ].push_back( operand );
+                    }
+                }
+
+                logical_frame f{ type, std::size( tasks ), std::size( tasks ), 0u, std::size( results ), std::size( grouped ) };
+
+                for ( auto const operand : operands )
+                {
+                    if ( is_foldable( operand, type ) )
+                    {
+                        auto const & group{ groups[ source.value( source[ source[ operand ].left ] ) ] };
+
+                        if ( std::size( group ) > 1u )
+                        {
+                            // the whole group is folded when its first operand is reached
+                            if ( group.front() != operand ) { continue; }
+
+                            auto const first{ static_cast< std::uint32_t >( std::size( grouped ) ) };
+                            grouped.insert( std::end( grouped ), std::cbegin( group ), std::cend( group ) );
+                            tasks.push_back( { operand, first, static_cast< std::uint32_t >( std::size( group ) ) } );
+                            continue;
+                        }
+                    }
+
+                    tasks.push_back( { operand, 0u, 0u } );
+                }
+
+                // groups are erased one by one, since clearing the map would take time proportional
+                // to the number of its buckets, grown by the largest of the logical operations
+                for ( auto const operand : operands )
+                {
+                    if ( is_foldable( operand, type ) )
+                    {
+                        groups.erase( source.value( source[ source[ operand ].left ] ) );
+                    }
+                }
+
+                f.last = std::size( tasks );
+                frames.push_back( f );
+            }
+        };
+
+        auto value{ null_node };
+
+        call( index );
+
+        while ( !frames.empty() )
+        {
+            auto & top{ frames.back() };
+
+            if ( top.next == top.last )
+            {
+                auto const count{ std::size( results ) - top.results };
+
+                if ( count == 1u )
+                {
+                    value = results.back();
+                }
+                else
+                {
+                    auto const first{ target.extra_size() };
+
+                    for ( auto i{ top.results }; i < std::size( results ); ++i )
+                    {
+                        target.extra( results[ i ] );
+                    }
+
+                    value = target.emplace_list( top.type, first );
+                }
+
+                results.resize( top.results );
+                tasks  .resize( top.first   );
+                grouped.resize( top.grouped );
+                frames .pop_back();
+
+                if ( !frames.empty() ) { results.push_back( value ); }
+                continue;
+            }
+
+            auto const current{ tasks[ top.next++ ] };
+
+            if ( current.count != 0u )
+            {
+                results.push_back( fold( source, { std::data( grouped ) + current.first, current.count }, folded( top.type ), target ) );
+            }
+            else if ( is_logical( source, current.operand ) )
+            {
+                call( current.operand );
+            }
+            else
+            {
+                results.push_back( copy_operand( source, current.operand, target ) );
+            }
+        }
+
+        return value;
+    }
+
+} // namespace internal
+
+/**
+ * Optimizes the expression tree by copying it from the source arena into the target one,
+ * while replacing the chains of equality tests of the same field combined with 'or', e.g.
+ * 'a == 1 or a == 2 or a == 3', with the single set membership operation 'a in (1, 2, 3)'.
+ * Likewise, the chains of inequality tests combined with 'and' are replaced with 'not in'.
+ * The set is then looked up at once instead of testing all of its elements one by one.
+ *
+ * @param source Arena containing the expression tree built from the expression
+ * @param target Arena to store the optimized expression tree into, reusing its storage
+ */
+inline void optimize( arena const & source, arena & target )
+{
+    target.clear();
+
+    if ( source.empty() ) { return; }
+
+    target.text( source.text() );
+    target.root( internal::optimize_node( source, source.root(), target ) );
+}
+
+} // namespace booleval::tree
+
+#endif // BOOLEVAL_OPTIMIZER_HPP
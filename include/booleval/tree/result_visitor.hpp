@@ -38,6 +38,7 @@
 #include <booleval/field.hpp>
 #include <booleval/result.hpp>
 #include <booleval/tree/node.hpp>
+#include <booleval/tree/arena.hpp>
 
 namespace booleval::tree
 {
@@ -63,55 +64,83 @@ public:
         fields_ = std::vector< std::unique_ptr< field_base > >{ std::begin( fields ), std::end( fields ) };
     }
 
+    /**
+     * Visits the root node of the expression tree stored in the arena.
+     *
+     * @param arena Arena containing the expression tree
+     * @param obj   Object to be evaluated
+     *
+     * @return Result
+     */
+    template< typename T >
+    [[ nodiscard ]] result visit( arena const & arena, T && obj ) const noexcept
+    {
+        return visit( arena, arena.root(), std::forward< T >( obj ) );
+    }
+
+private:
     /**
      * Visits tree node by checking token type and passing node itself
      * to specialized visitor's function.
      *
-     * @param node Currently visited tree node
+     * @param arena Arena containing the expression tree
+     * @param index Index of the currently visited tree node
+     * @param obj   Object to be evaluated
      *
      * @return Result
      */
     template< typename T >
-    [[ nodiscard ]] constexpr result visit( node const & node, T && obj ) const noexcept;
+    [[ nodiscard ]] result visit( arena const & arena, node_index const index, T && obj ) const noexcept;
 
-private:
     /**
-     * Visits tree node representing one of logical operations.
+     * Visits tree node representing one of logical operations. Operands are
+     * visited one after another until one of them decides the result, so the
+     * remaining operands are not visited at all.
      *
-     * @param node Currently visited tree node
-     * @param obj  Object to be evaluated
-     * @param func Logical operation function
+     * @param arena Arena containing the expression tree
+     * @param node  Currently visited tree node
+     * @param obj   Object to be evaluated
+     * @param func  Logical operation function
      *
      * @return Result
      */
     template< typename T, typename F >
-    [[ nodiscard ]] constexpr result visit_logical( node const & node, T && obj, F && f ) const noexcept
+    [[ nodiscard ]] result visit_logical( arena const & arena, node const & node, T && obj, F && f ) const noexcept
     {
-        auto const left { visit( *node.left , std::forward< T >( obj ) ) };
-        auto const right{ visit( *node.right, std::forward< T >( obj ) ) };
+        auto const operands{ arena.list( node ) };
+
+        result result{ visit( arena, operands[ 0 ], std::forward< T >( obj ) ) };
 
-        // always pick the error message closer to the beginning of the expression
-        auto const message
+        for ( std::size_t i{ 1u }; i < std::size( operands ); ++i )
         {
-            left.message.empty() ? right.message : left.message
-        };
+            // result does not depend on the rest of the operands, e.g. 'false and x' or 'true or x'
+            if ( f( result.success, true ) == f( result.success, false ) ) { break; }
 
-        return { f( left.success, right.success ), message };
+            auto const operand{ visit( arena, operands[ i ], std::forward< T >( obj ) ) };
+
+            result.success = f( result.success, operand.success );
+
+            // always pick the error message closer to the beginning of the expression
+            if ( result.message.empty() ) { result.message = operand.message; }
+        }
+
+        return result;
     }
 
     /**
      * Visits tree node representing one of relational operations.
      *
-     * @param node Currently visited tree node
-     * @param obj  Object to be evaluated
-     * @param func Comparison function
+     * @param arena Arena containing the expression tree
+     * @param node  Currently visited tree node
+     * @param obj   Object to be evaluated
+     * @param func  Comparison function
      *
      * @return Result
      */
     template< typename T, typename F >
-    [[ nodiscard ]] constexpr result visit_relational( node const & node, T && obj, F && f ) const noexcept
+    [[ nodiscard ]] result visit_relational( arena const & arena, node const & node, T && obj, F && f ) const noexcept
     {
-        auto const key{ node.left->token };
+        auto const key{ arena.value( arena[ node.left ] ) };
 
         auto const it
         {
@@ -121,7 +150,7 @@ private:
                 std::cend  ( fields_ ),
                 [ key ]( auto && field ) noexcept
                 {
-                    return field->name == key.value();
+                    return field->name == key;
                 }
             )
         };
@@ -136,35 +165,89 @@ private:
             f
             (
                 ( *it )->invoke( std::forward< T >( obj ) ),
-                node.right->token.value()
+                arena.value( arena[ node.right ] )
             )
         };
 
         return { success };
     }
 
+    /**
+     * Visits tree node representing one of set membership operations.
+     * Field value is in the set if it is equal to any of its elements,
+     * while it is not in the set if it differs from all of them.
+     *
+     * @param arena    Arena containing the expression tree
+     * @param node     Currently visited tree node
+     * @param obj      Object to be evaluated
+     * @param expected True for the 'in' operation, false for the 'not in' one
+     *
+     * @return Result
+     */
+    template< typename T >
+    [[ nodiscard ]] result visit_set( arena const & arena, node const & node, T && obj, bool const expected ) const noexcept
+    {
+        auto const key{ arena.value( arena[ node.left ] ) };
+
+        auto const it
+        {
+            std::find_if
+            (
+                std::cbegin( fields_ ),
+                std::cend  ( fields_ ),
+                [ key ]( auto && field ) noexcept
+                {
+                    return field->name == key;
+                }
+            )
+        };
+
+        if ( it == std::end( fields_ ) )
+        {
+            return { false, "Unknown field" };
+        }
+
+        auto const value{ ( *it )->invoke( std::forward< T >( obj ) ) };
+
+        for ( auto const element : arena.list( arena[ node.right ] ) )
+        {
+            auto const constant{ arena.value( arena[ element ] ) };
+
+            if ( expected ? value == constant : !( value != constant ) )
+            {
+                return { expected };
+            }
+        }
+
+        return { !expected };
+    }
+
 private:
     std::vector< std::unique_ptr< field_base > > fields_;
 };
 
 template< typename T >
-constexpr result result_visitor::visit( node const & node, T && obj ) const noexcept
+result result_visitor::visit( arena const & arena, node_index const index, T && obj ) const noexcept
 {
-    if ( nullptr == node.left || nullptr == node.right )
+    if ( index == null_node || !arena[ index ].has_children() )
     {
         return { false, "Missing operand" };
     }
 
-    switch ( node.token.type() )
+    auto const & node{ arena[ index ] };
+
+    switch ( node.type )
     {
-        case token::token_type::logical_and: return visit_logical   ( node, std::forward< T >( obj ), std::logical_and<>()   );
-        case token::token_type::logical_or : return visit_logical   ( node, std::forward< T >( obj ), std::logical_or<>()    );
-        case token::token_type::eq         : return visit_relational( node, std::forward< T >( obj ), std::equal_to<>()      );
-        case token::token_type::neq        : return visit_relational( node, std::forward< T >( obj ), std::not_equal_to<>()  );
-        case token::token_type::gt         : return visit_relational( node, std::forward< T >( obj ), std::greater<>()       );
-        case token::token_type::lt         : return visit_relational( node, std::forward< T >( obj ), std::less<>()          );
-        case token::token_type::geq        : return visit_relational( node, std::forward< T >( obj ), std::greater_equal<>() );
-        case token::token_type::leq        : return visit_relational( node, std::forward< T >( obj ), std::less_equal<>()    );
+        case token::token_type::logical_and: return visit_logical   ( arena, node, std::forward< T >( obj ), std::logical_and<>()   );
+        case token::token_type::logical_or : return visit_logical   ( arena, node, std::forward< T >( obj ), std::logical_or<>()    );
+        case token::token_type::eq         : return visit_relational( arena, node, std::forward< T >( obj ), std::equal_to<>()      );
+        case token::token_type::neq        : return visit_relational( arena, node, std::forward< T >( obj ), std::not_equal_to<>()  );
+        case token::token_type::gt         : return visit_relational( arena, node, std::forward< T >( obj ), std::greater<>()       );
+        case token::token_type::lt         : return visit_relational( arena, node, std::forward< T >( obj ), std::less<>()          );
+        case token::token_type::geq        : return visit_relational( arena, node, std::forward< T >( obj ), std::greater_equal<>() );
+        case token::token_type::leq        : return visit_relational( arena, node, std::forward< T >( obj ), std::less_equal<>()    );
+        case token::token_type::in         : return visit_set       ( arena, node, std::forward< T >( obj ), true                   );
+        case token::token_type::not_in     : return visit_set       ( arena, node, std::forward< T >( obj ), false                  );
 
         default:
             return { false, "Unknown token type" };
@@ -30,11 +30,13 @@
 #ifndef BOOLEVAL_TREE_HPP
 #define BOOLEVAL_TREE_HPP
 
-#include <memory>
 #include <vector>
+#include <cstdint>
+#include <algorithm>
 #include <string_view>
 
 #include <booleval/tree/node.hpp>
+#include <booleval/tree/arena.hpp>
 #include <booleval/token/tokenizer.hpp>
 
 namespace booleval::tree
@@ -45,164 +47,376 @@ namespace internal
 
     using tokens = std::vector< token::token >;
 
+    /**
+     * Token source over already tokenized expression, providing the same interface
+     * as the lexer does, i.e. empty, peek and next.
+     */
+    class token_cursor
+    {
+    public:
+        explicit token_cursor( tokens const & tokens ) noexcept : tokens_{ tokens } {}
+
+        [[ nodiscard ]] bool                 empty() const noexcept { return current_ == std::size( tokens_ ); }
+        [[ nodiscard ]] token::token const & peek () const noexcept { return tokens_[ current_ ];            }
+
+        token::token next() noexcept { return tokens_[ current_++ ]; }
+
+    private:
+        tokens const & tokens_;
+        std::size_t    current_{ 0u };
+    };
+
     // Forward declarations
 
-    std::unique_ptr< node > parse_expression          ( tokens const & tokens, std::size_t & current );
-    std::unique_ptr< node > parse_and_operation       ( tokens const & tokens, std::size_t & current );
-    std::unique_ptr< node > parse_parentheses         ( tokens const & tokens, std::size_t & current );
-    std::unique_ptr< node > parse_relational_operation( tokens const & tokens, std::size_t & current );
-    std::unique_ptr< node > parse_terminal            ( tokens const & tokens, std::size_t & current );
+    template< typename Tokens > node_index parse_relational_operation( Tokens & tokens, arena & arena );
+    template< typename Tokens > node_index parse_set                 ( Tokens & tokens, arena & arena );
+    template< typename Tokens > node_index parse_terminal            ( Tokens & tokens, arena & arena );
+    template< typename Tokens > node_index parse_value               ( Tokens & tokens, arena & arena );
 
     // Definitions
 
-    inline bool has_unused( tokens const & tokens, std::size_t const current ) noexcept
+    /**
+     * Checks whether the next token is of the specified type.
+     */
+    template< typename Tokens >
+    bool is_next( Tokens & tokens, token::token_type const type ) noexcept
     {
-        return current < std::size( tokens );
+        return !tokens.empty() && tokens.peek().is( type );
     }
 
-    inline std::unique_ptr< node > parse_expression( tokens const & tokens, std::size_t & current )
+    /**
+     * Appends the logical operation node keeping all the operands of the chain, e.g. 'a or b or c',
+     * instead of nesting the binary operations. Single operand is returned as it is, while the
+     * missing operand makes the whole operation miss its operands.
+     */
+    inline node_index emplace_logical( arena & arena, token::token_type const type, node_span const operands )
     {
-        auto left{ parse_and_operation( tokens, current ) };
+        if ( std::size( operands ) == 1u ) { return operands[ 0 ]; }
 
-        auto const is_relational_operator
+        if ( std::find( std::begin( operands ), std::end( operands ), null_node ) != std::end( operands ) )
         {
-            has_unused( tokens, current ) &&
-            tokens[ current ].is_one_of
-            (
-                token::token_type::eq,
-                token::token_type::neq,
-                token::token_type::gt,
-                token::token_type::lt,
-                token::token_type::geq,
-                token::token_type::leq
-            )
-        };
-
-        if ( is_relational_operator )
-        {
-            return nullptr;
+            return arena.emplace( type );
         }
 
-        if ( has_unused( tokens, current ) && tokens[ current ].is_not( token::token_type::logical_or ) )
-        {
-            return left;
-        }
+        auto const first{ arena.extra_size() };
 
-        while ( has_unused( tokens, current ) && tokens[ current ].is( token::token_type::logical_or ) )
+        for ( auto const operand : operands )
         {
-            ++current;
-            auto logical_or{ std::make_unique< node >( token::token_type::logical_or ) };
-
-            auto right{ parse_and_operation( tokens, current ) };
-            if ( right == nullptr ) { return nullptr; }
-
-            logical_or->left  = std::move( left  );
-            logical_or->right = std::move( right );
-            left = std::move( logical_or );
+            arena.extra( operand );
         }
 
-        return left;
+        return arena.emplace_list( type, first );
     }
 
-    inline std::unique_ptr< node > parse_and_operation( tokens const & tokens, std::size_t & current )
+    /**
+     * Rules of the grammar that contain other rules, i.e. the ones that would
+     * call each other recursively in a recursive descent parser:
+     *
+     * - expression:    and_operation { 'or' and_operation }
+     * - and_operation: operand { 'and' operand }, where operand is either
+     *                  parentheses or relational operation
+     * - parentheses:   '(' expression ')'
+     */
+    enum class rule : std::uint8_t
     {
-        auto left{ parse_parentheses( tokens, current ) };
-        if ( left == nullptr )
-        {
-            left = parse_relational_operation( tokens, current );
-        }
+        expression,
+        and_operation,
+        parentheses
+    };
+
+    /**
+     * Rule being parsed along with the point reached within the rule and the position
+     * of its first operand on the operand stack.
+     */
+    struct frame
+    {
+        rule         kind { rule::expression };
+        std::uint8_t stage{ 0u               };
+        std::size_t  first{ 0u               };
+    };
+
+    /**
+     * Parses the expression by using the explicit stack of rules instead of the native
+     * call stack, so the nesting depth of the parentheses is not limited by the stack size.
+     * Each token is consumed once and each operand is pushed onto the operand stack once,
+     * so the expression is parsed in linear time. Frames and operands stacks are reused
+     * between the rules, so parsing a rule does not allocate on its own.
+     *
+     * Tokens are pulled from the token source one by one, looking at most one token ahead,
+     * so the lexer splits the expression only up to the point where parsing ends.
+     *
+     * @param tokens Token source of the expression, e.g. lexer
+     * @param arena  Arena to store the nodes into
+     *
+     * @return Index of the root node or null node if the expression is invalid
+     */
+    template< typename Tokens >
+    node_index parse( Tokens & tokens, arena & arena )
+    {
+        std::vector< frame      > frames  { { rule::expression, 0u, 0u } };
+        std::vector< node_index > operands{};
 
-        if ( left == nullptr ) { return nullptr; }
+        // value of the most recently parsed rule
+        auto value{ null_node };
 
-        while ( has_unused( tokens, current ) && tokens[ current ].is( token::token_type::logical_and ) )
+        auto const call
         {
-            ++current;
+            [ & ]( rule const r )
+            {
+                frames.push_back( { r, 0u, std::size( operands ) } );
+            }
+        };
 
-            auto logical_and{ std::make_unique< node >( token::token_type::logical_and ) };
+        auto const finish
+        {
+            [ & ]( node_index const result )
+            {
+                operands.resize( frames.back().first );
+                frames.pop_back();
+                value = result;
+            }
+        };
 
-            auto right{ parse_parentheses( tokens, current ) };
-            if ( right == nullptr )
+        auto const finish_logical
+        {
+            [ & ]( token::token_type const type )
             {
-                right = parse_relational_operation( tokens, current );
+                auto const first{ frames.back().first };
+                finish( emplace_logical( arena, type, { std::data( operands ) + first, std::size( operands ) - first } ) );
             }
+        };
 
-            if ( right == nullptr ) { return nullptr; }
+        while ( !frames.empty() )
+        {
+            auto & top{ frames.back() };
 
-            logical_and->left  = std::move( left  );
-            logical_and->right = std::move( right );
-            left = std::move( logical_and );
+            switch ( top.kind )
+            {
+                case rule::expression:
+                {
+                    if ( top.stage == 0u )
+                    {
+                        top.stage = 1u;
+                        call( rule::and_operation );
+                        break;
+                    }
+
+                    if ( top.stage == 1u )
+                    {
+                        auto const is_relational_operator
+                        {
+                            !tokens.empty() &&
+                            tokens.peek().is_one_of
+                            (
+                                token::token_type::eq,
+                                token::token_type::neq,
+                                token::token_type::gt,
+                                token::token_type::lt,
+                                token::token_type::geq,
+                                token::token_type::leq,
+                                token::token_type::in,
+                                token::token_type::not_in
+                            )
+                        };
+
+                        if ( is_relational_operator ) { finish( null_node ); break; }
+
+                        if ( !is_next( tokens, token::token_type::logical_or ) ) { finish( value ); break; }
+
+                        top.stage = 2u;
+                    }
+                    else if ( value == null_node )
+                    {
+                        finish( null_node );
+                        break;
+                    }
+
+                    operands.push_back( value );
+
+                    if ( is_next( tokens, token::token_type::logical_or ) )
+                    {
+                        tokens.next();
+                        call( rule::and_operation );
+                    }
+                    else
+                    {
+                        finish_logical( token::token_type::logical_or );
+                    }
+                    break;
+                }
+
+                case rule::and_operation:
+                {
+                    if ( top.stage == 0u )
+                    {
+                        top.stage = 1u;
+                        call( rule::parentheses );
+                        break;
+                    }
+
+                    if ( value == null_node )
+                    {
+                        value = parse_relational_operation( tokens, arena );
+                    }
+
+                    if ( value == null_node ) { finish( null_node ); break; }
+
+                    if ( top.stage == 1u && !is_next( tokens, token::token_type::logical_and ) )
+                    {
+                        finish( value );
+                        break;
+                    }
+
+                    top.stage = 2u;
+                    operands.push_back( value );
+
+                    if ( is_next( tokens, token::token_type::logical_and ) )
+                    {
+                        tokens.next();
+                        call( rule::parentheses );
+                    }
+                    else
+                    {
+                        finish_logical( token::token_type::logical_and );
+                    }
+                    break;
+                }
+
+                case rule::parentheses:
+                {
+                    if ( top.stage == 0u )
+                    {
+                        if ( !is_next( tokens, token::token_type::lp ) ) { finish( null_node ); break; }
+
+                        tokens.next();
+                        top.stage = 1u;
+                        call( rule::expression );
+                        break;
+                    }
+
+                    if ( tokens.empty() ) { finish( null_node ); break; }
+
+                    finish( tokens.next().is( token::token_type::rp ) ? value : null_node );
+                    break;
+                }
+            }
         }
 
-        return left;
+        return value;
     }
 
-    inline std::unique_ptr< node > parse_parentheses( tokens const & tokens, std::size_t & current )
+    template< typename Tokens >
+    node_index parse_relational_operation( Tokens & tokens, arena & arena )
     {
-        if ( !has_unused( tokens, current ) ) { return nullptr; }
+        auto const left{ parse_terminal( tokens, arena ) };
+        if ( left == null_node ) { return null_node; }
 
-        if ( tokens[ current ].is( token::token_type::lp ) )
-        {
-            ++current;
-            auto expression{ parse_expression( tokens, current ) };
-            if ( !has_unused( tokens, current ) ) { return nullptr; }
+        if ( tokens.empty() ) { return null_node; }
 
-            if ( tokens[ current++ ].is( token::token_type::rp ) )
-            {
-                return expression;
-            }
-        }
+        auto const operation{ tokens.next() };
 
-        return nullptr;
+        auto const right
+        {
+            operation.is_one_of( token::token_type::in, token::token_type::not_in )
+                ? parse_set  ( tokens, arena )
+                : parse_value( tokens, arena )
+        };
+        if ( right == null_node ) { return null_node; }
+
+        return arena.emplace( operation, left, right );
     }
 
-    inline std::unique_ptr< node > parse_relational_operation( tokens const & tokens, std::size_t & current )
+    template< typename Tokens >
+    node_index parse_set( Tokens & tokens, arena & arena )
     {
-        auto left{ parse_terminal( tokens, current ) };
-        if ( left == nullptr ) { return nullptr; }
+        if ( tokens.empty() || tokens.peek().is_not( token::token_type::lp ) ) { return null_node; }
+
+        tokens.next();
+
+        auto const first{ arena.extra_size() };
+        auto       has_parameter{ false };
+
+        while ( true )
+        {
+            auto const element{ parse_value( tokens, arena ) };
+            if ( element == null_node || tokens.empty() ) { return null_node; }
 
-        if ( !has_unused( tokens, current ) ) { return nullptr; }
+            arena.extra( element );
+            has_parameter = has_parameter || arena[ element ].type == token::token_type::parameter;
 
-        auto operation{ std::make_unique< node >( tokens[ current++ ] ) };
+            auto const separator{ tokens.next() };
 
-        auto right{ parse_terminal( tokens, current ) };
-        if ( right == nullptr ) { return nullptr; }
+            if ( separator.is( token::token_type::rp    ) ) { break;    }
+            if ( separator.is( token::token_type::comma ) ) { continue; }
 
-        operation->left  = std::move( left  );
-        operation->right = std::move( right );
+            return null_node;
+        }
+
+        // parameter stands for all the values of the set, e.g. 'field in (?)'
+        if ( has_parameter && arena.extra_size() - first > 1u ) { return null_node; }
 
-        return operation;
+        return arena.emplace_list( token::token_type::lp, first );
     }
 
-    inline std::unique_ptr< node > parse_terminal( tokens const & tokens, std::size_t & current )
+    template< typename Tokens >
+    node_index parse_terminal( Tokens & tokens, arena & arena )
     {
-        if ( !has_unused( tokens, current ) ) { return nullptr; }
+        if ( tokens.empty() ) { return null_node; }
 
-        auto const & token{ tokens[ current++ ] };
+        auto const token{ tokens.next() };
         if ( token.is( token::token_type::field ) )
         {
-            return std::make_unique< node >( token );
+            return arena.emplace( token );
         }
         else
         {
-            return nullptr;
+            return null_node;
         }
     }
 
+    template< typename Tokens >
+    node_index parse_value( Tokens & tokens, arena & arena )
+    {
+        if ( is_next( tokens, token::token_type::parameter ) )
+        {
+            return arena.emplace( tokens.next() );
+        }
+
+        return parse_terminal( tokens, arena );
+    }
+
 } // namespace internal
 
 /**
- * Builds an expression tree by using a recursive descent parser method.
+ * Builds an expression tree by using a parser keeping the rules being parsed on its own
+ * stack, so it runs in linear time regardless of the nesting depth of the parentheses.
+ * All the nodes are stored into the specified arena, reusing its storage. Parser pulls
+ * the tokens from the lexer on demand, so the tokens are not stored anywhere and the
+ * rest of the expression is not split once the parsing fails.
+ *
+ * @param expression Expression to build the tree for
+ * @param arena      Arena to store the nodes into
+ *
+ * @return True if the expression tree is successfully built, otherwise false
  */
-std::unique_ptr< node > build( std::string_view expression )
+inline bool build( std::string_view const expression, arena & arena )
 {
-    auto const tokens{ token::tokenize( expression ) };
-    if ( tokens.empty() ) { return nullptr; }
+    arena.clear();
 
-    std::size_t current{ 0u };
+    token::lexer tokens{ arena.text( expression ) };
+    if ( tokens.empty() ) { return false; }
+
+    auto const root{ internal::parse( tokens, arena ) };
+    if ( root == null_node )
+    {
+        arena.clear();
+        return false;
+    }
 
-    return internal::parse_expression( tokens, current );
+    arena.root( root );
+    return true;
 }
 
 } // namespace booleval::tree
 
-#endif // BOOLEVAL_TREE_HPP
\ No newline at end of file
+#endif // BOOLEVAL_TREE_HPP
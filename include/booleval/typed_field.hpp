@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef BOOLEVAL_TYPED_FIELD_HPP
+#define BOOLEVAL_TYPED_FIELD_HPP
+
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+#include <booleval/utils/any_value.hpp>
+
+namespace booleval
+{
+
+/**
+ * @class field_offset
+ *
+ * Represents the raw descriptor of the class member of type R placed
+ * at the offset (in bytes) from the beginning of the object, e.g.
+ * field_offset< double >{ offsetof( quote, price ) }.
+ */
+template< typename R >
+struct field_offset
+{
+    std::size_t offset{ 0u };
+};
+
+/**
+ * @class typed_field
+ *
+ * Represents a field of the class known at compile time. Unlike the field,
+ * it is a plain value that needs neither RTTI nor heap allocation: the getter
+ * member function pointer is stored in place and invoked through a plain
+ * function pointer instantiated for the getter's return type.
+ *
+ * Public data members and raw offset descriptors are read directly from
+ * the object, without calling any getter.
+ */
+template< typename C >
+class typed_field
+{
+public:
+    typed_field() = default;
+
+    template< typename R >
+    typed_field( std::string_view const name, R ( C::*m )() const ) noexcept
+        : name   { name                        }
+        , invoke_{ &call< R ( C::* )() const > }
+    {
+        store( m );
+    }
+
+    template
+    <
+        typename R,
+        typename std::enable_if_t< !std::is_function_v< R > >* = nullptr
+    >
+    typed_field( std::string_view const name, R C::*m ) noexcept
+        : name   { name              }
+        , invoke_{ &read< R C::* > }
+    {
+        store( m );
+    }
+
+    template< typename R >
+    typed_field( std::string_view const name, field_offset< R > const offset ) noexcept
+        : name   { name          }
+        , invoke_{ &read_at< R > }
+    {
+        store( offset.offset );
+    }
+
+    /**
+     * Gets the value of the field for the object passed in.
+     *
+     * @param obj Object to get the field value from
+     *
+     * @return Field value
+     */
+    [[ nodiscard ]] utils::any_value invoke( C const & obj ) const noexcept
+    {
+        if ( invoke_ == nullptr ) { return {}; }
+
+        return invoke_( obj, accessor_ );
+    }
+
+    std::string_view name{};
+
+private:
+    // member pointers of the same class have the same size regardless of the member type
+    static constexpr std::size_t accessor_size{ sizeof( void ( C::* )() const ) };
+
+    using accessor = unsigned char[ accessor_size ];
+    using invoker  = utils::any_value ( * )( C const &, accessor const & ) noexcept;
+
+    template< typename M >
+    void store( M const m ) noexcept
+    {
+        static_assert( sizeof( M ) <= accessor_size, "Member pointer does not fit into the field" );
+        static_assert( std::is_trivially_copyable_v< M >, "Member pointer has to be trivially copyable" );
+
+        std::memcpy( accessor_, &m, sizeof( M ) );
+    }
+
+    template< typename M >
+    static utils::any_value call( C const & obj, accessor const & storage ) noexcept
+    {
+        M m;
+        std::memcpy( &m, storage, sizeof( M ) );
+
+        // converting in place keeps references returned by the getter, so strings are not copied
+        return ( obj.*m )();
+    }
+
+    template< typename M >
+    static utils::any_value read( C const & obj, accessor const & storage ) noexcept
+    {
+        M m;
+        std::memcpy( &m, storage, sizeof( M ) );
+
+        return obj.*m;
+    }
+
+    template< typename R >
+    static utils::any_value read_at( C const & obj, accessor const & storage ) noexcept
+    {
+        std::size_t offset;
+        std::memcpy( &offset, storage, sizeof( offset ) );
+
+        return *reinterpret_cast< R const * >( reinterpret_cast< unsigned char const * >( &obj ) + offset );
+    }
+
+    invoker  invoke_  { nullptr };
+    accessor accessor_{};
+};
+
+} // namespace booleval
+
+#endif // BOOLEVAL_TYPED_FIELD_HPP
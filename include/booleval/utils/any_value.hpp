@@ -27,12 +27,16 @@
  *
  */
 
+
 #ifndef BOOLEVAL_ANY_VALUE_HPP
 #define BOOLEVAL_ANY_VALUE_HPP
 
 #include <string>
+#include <cstdint>
+#include <functional>
+#include <string_view>
 #include <type_traits>
-#include <booleval/utils/string_utils.hpp>
+#include <booleval/utils/constant.hpp>
 
 namespace booleval::utils
 {
@@ -41,117 +45,332 @@ namespace booleval::utils
  * @class any_value
  *
  * Represents the class that accepts any type of value through its constructor
- * or assignment operator and internally stores its string version.
+ * or assignment operator and internally stores it in its native form.
+ * Integers and floating point values are stored as they are, while strings
+ * are referred to without copying them. Only temporary string objects are
+ * stored inside of the value since nothing else would keep them alive.
  */
 class any_value
 {
 public:
-    any_value() = default;
+    /**
+     * Kind of the value being stored.
+     */
+    enum class kind : std::uint8_t
+    {
+        none,
+        signed_integer,
+        unsigned_integer,
+        single_precision,
+        double_precision,
+        string
+    };
 
-    any_value( any_value       && rhs ) = default;
-    any_value( any_value const  & rhs ) = default;
+    any_value() noexcept = default;
 
-    template< typename T >
+    any_value( any_value && rhs ) noexcept
+        : number_{ rhs.number_             }
+        , view_  { rhs.view_               }
+        , owned_ { std::move( rhs.owned_ ) }
+        , kind_  { rhs.kind_               }
+        , owns_  { rhs.owns_               }
+    {
+        if ( owns_ ) { view_ = owned_; }
+        rhs.reset();
+    }
+
+    any_value( any_value const & rhs )
+        : number_{ rhs.number_ }
+        , view_  { rhs.view_   }
+        , owned_ { rhs.owned_  }
+        , kind_  { rhs.kind_   }
+        , owns_  { rhs.owns_   }
+    {
+        if ( owns_ ) { view_ = owned_; }
+    }
+
+    template
+    <
+        typename T,
+        typename std::enable_if_t< !std::is_same_v< std::decay_t< T >, any_value > >* = nullptr
+    >
     any_value( T && rhs ) noexcept
     {
-        if constexpr ( std::is_arithmetic_v< std::remove_reference_t< T > > )
-        {
-            value_ = utils::to_chars< std::remove_reference_t< T > >( std::forward< T >( rhs ) );
-            use_string_comparison_ = false;
-        }
-        else if constexpr ( std::is_constructible_v< std::string, std::remove_reference_t< T > > )
-        {
-            value_ = std::forward< T >( rhs );
-            use_string_comparison_ = true;
-        }
+        assign( std::forward< T >( rhs ) );
     }
 
-    any_value& operator=( any_value       && rhs ) = default;
-    any_value& operator=( any_value const  & rhs ) = default;
+    any_value& operator=( any_value && rhs ) noexcept
+    {
+        number_ = rhs.number_;
+        view_   = rhs.view_;
+        owned_  = std::move( rhs.owned_ );
+        kind_   = rhs.kind_;
+        owns_   = rhs.owns_;
 
-    template< typename T >
+        if ( owns_ ) { view_ = owned_; }
+        rhs.reset();
+
+        return *this;
+    }
+
+    any_value& operator=( any_value const & rhs )
+    {
+        number_ = rhs.number_;
+        view_   = rhs.view_;
+        owned_  = rhs.owned_;
+        kind_   = rhs.kind_;
+        owns_   = rhs.owns_;
+
+        if ( owns_ ) { view_ = owned_; }
+
+        return *this;
+    }
+
+    template
+    <
+        typename T,
+        typename std::enable_if_t< !std::is_same_v< std::decay_t< T >, any_value > >* = nullptr
+    >
     any_value& operator=( T && rhs ) noexcept
     {
-        if constexpr ( std::is_arithmetic_v< std::remove_reference_t< T > > )
+        assign( std::forward< T >( rhs ) );
+        return *this;
+    }
+
+    [[ nodiscard ]] kind type() const noexcept { return kind_; }
+
+    /**
+     * Gets the hash of the value. Strings are hashed the same way as the text of
+     * the constant, while numeric values with the precision they are compared with:
+     * integers exactly, floats with single and doubles with double precision.
+     *
+     * @return Hash of the value
+     */
+    [[ nodiscard ]] std::size_t hash() const noexcept
+    {
+        switch ( kind_ )
         {
-            value_ = utils::to_chars< std::remove_reference_t< T > >( std::forward< T >( rhs ) );
-            use_string_comparison_ = false;
+            case kind::signed_integer  : return hash_integer( number_.signed_integer );
+            case kind::unsigned_integer: return hash_integer( static_cast< std::int64_t >( number_.unsigned_integer ) );
+            case kind::single_precision: return hash_single ( number_.single_precision );
+            case kind::double_precision: return hash_double ( number_.double_precision );
+            case kind::string          : return std::hash< std::string_view >{}( view_ );
+
+            default:
+                return 0u;
         }
-        else if constexpr ( std::is_constructible_v< std::string, std::remove_reference_t< T > > )
+    }
+
+    /**
+     * Gets the value converted to double, or zero if the value is not numeric.
+     *
+     * @return Numeric value as double
+     */
+    [[ nodiscard ]] double number() const noexcept
+    {
+        switch ( kind_ )
         {
-            value_ = std::forward< T >( rhs );
-            use_string_comparison_ = true;
+            case kind::signed_integer  : return static_cast< double >( number_.signed_integer   );
+            case kind::unsigned_integer: return static_cast< double >( number_.unsigned_integer );
+            case kind::single_precision: return static_cast< double >( number_.single_precision );
+            case kind::double_precision: return number_.double_precision;
+
+            default:
+                return 0.;
         }
-        return *this;
     }
 
-    template< typename T >
+    template
+    <
+        typename T,
+        typename std::enable_if_t< !std::is_same_v< std::decay_t< T >, constant > >* = nullptr
+    >
     [[ nodiscard ]] bool operator==( T && rhs ) const noexcept
     {
-        return compare( value_, rhs, std::equal_to<>{} );
+        return compare( rhs, std::equal_to<>{} );
     }
 
-    template< typename T >
+    template
+    <
+        typename T,
+        typename std::enable_if_t< !std::is_same_v< std::decay_t< T >, constant > >* = nullptr
+    >
     [[ nodiscard ]] bool operator!=( T && rhs ) const noexcept
     {
-        return compare( value_, rhs, std::not_equal_to<>{} );
+        return compare( rhs, std::not_equal_to<>{} );
     }
 
     [[ nodiscard ]] bool operator>( std::string_view const rhs ) const noexcept
     {
-        return compare( value_, rhs, std::greater<>{} );
+        return compare( rhs, std::greater<>{} );
     }
 
     [[ nodiscard ]] bool operator<( std::string_view const rhs ) const noexcept
     {
-        return compare( value_, rhs, std::less<>{} );
+        return compare( rhs, std::less<>{} );
     }
 
     [[ nodiscard ]] bool operator>=( std::string_view const rhs ) const noexcept
     {
-        return compare( value_, rhs, std::greater_equal<>{} );
+        return compare( rhs, std::greater_equal<>{} );
     }
 
     [[ nodiscard ]] bool operator<=( std::string_view const rhs ) const noexcept
     {
-        return compare( value_, rhs, std::less_equal<>{} );
+        return compare( rhs, std::less_equal<>{} );
     }
 
+    [[ nodiscard ]] bool operator==( constant const & rhs ) const noexcept { return compare( rhs, std::equal_to<>{}      ); }
+    [[ nodiscard ]] bool operator!=( constant const & rhs ) const noexcept { return compare( rhs, std::not_equal_to<>{}  ); }
+    [[ nodiscard ]] bool operator> ( constant const & rhs ) const noexcept { return compare( rhs, std::greater<>{}       ); }
+    [[ nodiscard ]] bool operator< ( constant const & rhs ) const noexcept { return compare( rhs, std::less<>{}          ); }
+    [[ nodiscard ]] bool operator>=( constant const & rhs ) const noexcept { return compare( rhs, std::greater_equal<>{} ); }
+    [[ nodiscard ]] bool operator<=( constant const & rhs ) const noexcept { return compare( rhs, std::less_equal<>{}    ); }
+
     ~any_value() = default;
 
     friend bool operator==( any_value const & lhs, any_value const & rhs ) noexcept;
     friend bool operator!=( any_value const & lhs, any_value const & rhs ) noexcept;
 
 private:
+    template< typename T >
+    void assign( T && rhs ) noexcept
+    {
+        using type = std::decay_t< T >;
+
+        owns_ = false;
+
+        if constexpr ( std::is_same_v< type, bool > )
+        {
+            kind_                   = kind::unsigned_integer;
+            number_.unsigned_integer = rhs ? 1u : 0u;
+        }
+        else if constexpr ( std::is_integral_v< type > && std::is_signed_v< type > )
+        {
+            kind_                 = kind::signed_integer;
+            number_.signed_integer = static_cast< std::int64_t >( rhs );
+        }
+        else if constexpr ( std::is_integral_v< type > )
+        {
+            kind_                   = kind::unsigned_integer;
+            number_.unsigned_integer = static_cast< std::uint64_t >( rhs );
+        }
+        else if constexpr ( std::is_same_v< type, float > )
+        {
+            kind_                   = kind::single_precision;
+            number_.single_precision = rhs;
+        }
+        else if constexpr ( std::is_floating_point_v< type > )
+        {
+            kind_                   = kind::double_precision;
+            number_.double_precision = static_cast< double >( rhs );
+        }
+        else if constexpr ( std::is_same_v< type, std::string > && !std::is_lvalue_reference_v< T > )
+        {
+            kind_  = kind::string;
+            owned_ = std::forward< T >( rhs );
+            view_  = owned_;
+            owns_  = true;
+        }
+        else if constexpr ( std::is_convertible_v< T, std::string_view > )
+        {
+            kind_ = kind::string;
+            view_ = rhs;
+        }
+        else if constexpr ( std::is_constructible_v< std::string, T > )
+        {
+            kind_  = kind::string;
+            owned_ = std::string( std::forward< T >( rhs ) );
+            view_  = owned_;
+            owns_  = true;
+        }
+        else
+        {
+            reset();
+        }
+    }
+
+    void reset() noexcept
+    {
+        kind_ = kind::none;
+        view_ = {};
+        owns_ = false;
+    }
+
+    template< typename F >
+    bool compare( std::string_view const rhs, F && f ) const noexcept
+    {
+        if ( kind_ == kind::string ) { return f( view_, rhs ); }
+
+        return compare( constant{ rhs }, std::forward< F >( f ) );
+    }
 
     template< typename F >
-    bool compare( std::string_view const lhs, std::string_view const rhs, F && f ) const noexcept
+    bool compare( constant const & rhs, F && f ) const noexcept
     {
-        if ( use_string_comparison_ ) { return f( lhs, rhs ); }
+        if ( kind_ == kind::string ) { return f( view_, rhs.text() ); }
 
-        auto const arithmetic_lhs{ utils::from_chars< double >( lhs ) };
-        auto const arithmetic_rhs{ utils::from_chars< double >( rhs ) };
+        if ( !rhs.numeric() ) { return false; }
 
-        if ( arithmetic_lhs && arithmetic_rhs )
+        auto const is_integer{ rhs.type() == constant::kind::integer };
+
+        switch ( kind_ )
         {
-            return f( arithmetic_lhs.value(), arithmetic_rhs.value() );
-        }
+            case kind::signed_integer:
+                if ( is_integer ) { return f( number_.signed_integer, rhs.integer() ); }
+                return f( static_cast< double >( number_.signed_integer ), rhs.number() );
 
-        return false;
+            case kind::unsigned_integer:
+                if ( !is_integer ) { return f( static_cast< double >( number_.unsigned_integer ), rhs.number() ); }
+
+                // any unsigned value is greater than a negative constant
+                if ( rhs.integer() < 0 ) { return f( 0, -1 ); }
+                return f( number_.unsigned_integer, static_cast< std::uint64_t >( rhs.integer() ) );
+
+            // floats are compared with the precision they are stored with
+            case kind::single_precision: return f( number_.single_precision, static_cast< float >( rhs.number() ) );
+            case kind::double_precision: return f( number_.double_precision, rhs.number()                        );
+
+            default:
+                return false;
+        }
     }
 
-    std::string value_;
-    bool        use_string_comparison_{ false };
+    union numeric
+    {
+        std::int64_t  signed_integer;
+        std::uint64_t unsigned_integer;
+        float         single_precision;
+        double        double_precision;
+    };
+
+    numeric          number_{};
+    std::string_view view_  {};
+    std::string      owned_ {};
+    kind             kind_  { kind::none };
+    bool             owns_  { false };
 };
 
 [[ nodiscard ]] inline bool operator==( any_value const & lhs, any_value const & rhs ) noexcept
 {
-    return lhs.value_ == rhs.value_;
+    if ( lhs.kind_ != rhs.kind_ ) { return false; }
+
+    switch ( lhs.kind_ )
+    {
+        case any_value::kind::signed_integer  : return lhs.number_.signed_integer   == rhs.number_.signed_integer;
+        case any_value::kind::unsigned_integer: return lhs.number_.unsigned_integer == rhs.number_.unsigned_integer;
+        case any_value::kind::single_precision: return lhs.number_.single_precision == rhs.number_.single_precision;
+        case any_value::kind::double_precision: return lhs.number_.double_precision == rhs.number_.double_precision;
+        case any_value::kind::string          : return lhs.view_                    == rhs.view_;
+
+        default:
+            return true;
+    }
 }
 
 [[ nodiscard ]] inline bool operator!=( any_value const & lhs, any_value const & rhs ) noexcept
 {
-    return lhs.value_ != rhs.value_;
+    return !( lhs == rhs );
 }
 
 } // namespace booleval::utils
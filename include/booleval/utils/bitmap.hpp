@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef BOOLEVAL_BITMAP_HPP
+#define BOOLEVAL_BITMAP_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+#if defined( _MSC_VER ) && !defined( __clang__ )
+#include <intrin.h>
+#endif
+
+namespace booleval::utils
+{
+
+/**
+ * Gets the position of the lowest set bit of the word.
+ *
+ * @param word Word having at least one bit set
+ *
+ * @return Position of the lowest set bit
+ */
+[[ nodiscard ]] inline unsigned lowest_bit( std::uint64_t const word ) noexcept
+{
+#if defined( __GNUC__ ) || defined( __clang__ )
+    return static_cast< unsigned >( __builtin_ctzll( word ) );
+#elif defined( _MSC_VER )
+    unsigned long index{ 0u };
+    _BitScanForward64( &index, word );
+    return static_cast< unsigned >( index );
+#else
+    unsigned index{ 0u };
+    while ( ( word >> index & 1u ) == 0u ) { ++index; }
+    return index;
+#endif
+}
+
+/**
+ * Gets the number of the set bits of the word.
+ *
+ * @param word Word
+ *
+ * @return Number of the set bits
+ */
+[[ nodiscard ]] inline std::size_t popcount( std::uint64_t word ) noexcept
+{
+#if defined( __GNUC__ ) || defined( __clang__ )
+    return static_cast< std::size_t >( __builtin_popcountll( word ) );
+#else
+    std::size_t count{ 0u };
+    for ( ; word != 0u; word &= word - 1u ) { ++count; }
+    return count;
+#endif
+}
+
+/**
+ * @class bitmap
+ *
+ * Represents the packed selection of the objects of the batch, one bit per object.
+ * Bit i of word i / 64 is set if the object at index i is selected.
+ */
+class bitmap
+{
+public:
+    static constexpr std::size_t word_bits{ 64u };
+
+    bitmap() = default;
+
+    explicit bitmap( std::size_t const size )
+    {
+        reset( size );
+    }
+
+    /**
+     * Resizes the bitmap and clears all of its bits while keeping the allocated storage.
+     *
+     * @param size Number of the bits
+     */
+    void reset( std::size_t const size )
+    {
+        size_ = size;
+        words_.assign( ( size + word_bits - 1u ) / word_bits, 0u );
+    }
+
+    /**
+     * Sets the bit at the specified index.
+     *
+     * @param index Bit index
+     */
+    void set( std::size_t const index ) noexcept
+    {
+        words_[ index / word_bits ] |= std::uint64_t{ 1u } << index % word_bits;
+    }
+
+    /**
+     * Checks whether the bit at the specified index is set.
+     *
+     * @param index Bit index
+     *
+     * @return True if the bit is set, otherwise false
+     */
+    [[ nodiscard ]] bool test( std::size_t const index ) const noexcept
+    {
+        return ( words_[ index / word_bits ] >> index % word_bits & 1u ) != 0u;
+    }
+
+    /**
+     * Gets the number of the set bits.
+     *
+     * @return Number of the selected objects
+     */
+    [[ nodiscard ]] std::size_t count() const noexcept
+    {
+        std::size_t result{ 0u };
+        for ( auto const word : words_ ) { result += popcount( word ); }
+        return result;
+    }
+
+    /**
+     * Appends the indices of the set bits in ascending order, i.e. converts the bitmap
+     * into the selection vector.
+     *
+     * @param indices Vector the indices are appended to
+     */
+    template< typename Index >
+    void indices( std::vector< Index > & indices ) const
+    {
+        for ( std::size_t w{ 0u }; w < std::size( words_ ); ++w )
+        {
+            for ( auto word{ words_[ w ] }; word != 0u; word &= word - 1u )
+            {
+                indices.push_back( static_cast< Index >( w * word_bits + lowest_bit( word ) ) );
+            }
+        }
+    }
+
+    [[ nodiscard ]] std::uint64_t       * data()       noexcept { return std::data( words_ ); }
+    [[ nodiscard ]] std::uint64_t const * data() const noexcept { return std::data( words_ ); }
+
+    [[ nodiscard ]] std::size_t words() const noexcept { return std::size( words_ ); }
+    [[ nodiscard ]] std::size_t size () const noexcept { return size_;               }
+
+private:
+    std::vector< std::uint64_t > words_{};
+    std::size_t                  size_ { 0u };
+};
+
+} // namespace booleval::utils
+
+#endif // BOOLEVAL_BITMAP_HPP
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef BOOLEVAL_CHAR_CLASS_HPP
+#define BOOLEVAL_CHAR_CLASS_HPP
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+
+#include <booleval/utils/bitmap.hpp>
+#include <booleval/utils/instruction_set.hpp>
+
+namespace booleval::utils
+{
+
+/**
+ * @class char_class
+ *
+ * Represents the set of characters looked up by the low and the high nibble of the character.
+ * Characters of the set sharing the high nibble form a group having its own bit, so the
+ * character is in the set if the bits its low nibble and its high nibble map to intersect.
+ * Both lookups are a single byte shuffle in SIMD registers, so the whole register of
+ * characters is classified at once. Up to 8 distinct high nibbles can be present in the set.
+ */
+class char_class
+{
+public:
+    constexpr char_class() noexcept = default;
+
+    /**
+     * Adds the character into the set.
+     *
+     * @param c Character
+     *
+     * @return True if the character is added, false if there are too many distinct high nibbles
+     */
+    constexpr bool insert( char const c ) noexcept
+    {
+        auto const byte{ static_cast< std::uint8_t >( c ) };
+
+        auto & group{ high_[ byte >> 4 ] };
+        if ( group == 0u )
+        {
+            if ( groups_ == 8u ) { return false; }
+            group = static_cast< std::uint8_t >( 1u << groups_++ );
+        }
+
+        low_[ byte & 0x0Fu ] |= group;
+        return true;
+    }
+
+    /**
+     * Checks whether the character is in the set.
+     *
+     * @param c Character
+     *
+     * @return True if the character is in the set, otherwise false
+     */
+    [[ nodiscard ]] constexpr bool contains( char const c ) const noexcept
+    {
+        auto const byte{ static_cast< std::uint8_t >( c ) };
+        return ( low_[ byte & 0x0Fu ] & high_[ byte >> 4 ] ) != 0u;
+    }
+
+    [[ nodiscard ]] constexpr std::uint8_t const * low () const noexcept { return std::data( low_  ); }
+    [[ nodiscard ]] constexpr std::uint8_t const * high() const noexcept { return std::data( high_ ); }
+
+private:
+    std::array< std::uint8_t, 16 > low_   {};
+    std::array< std::uint8_t, 16 > high_  {};
+    std::uint8_t                   groups_{ 0u };
+};
+
+namespace scalar
+{
+
+    /**
+     * Finds the first character of the range that is in the set.
+     *
+     * @param first Pointer to the first character
+     * @param last  Pointer past the last character
+     * @param set   Set of characters
+     *
+     * @return Pointer to the first character in the set or last if there is none
+     */
+    [[ nodiscard ]] inline char const * find( char const * first, char const * last, char_class const & set ) noexcept
+    {
+        while ( first != last && !set.contains( *first ) ) { ++first; }
+        return first;
+    }
+
+} // namespace scalar
+
+#if defined( BOOLEVAL_SIMD )
+
+namespace sse42
+{
+
+    /**
+     * Classifies 16 characters at a time. Characters past the last multiple of 16 are
+     * classified one by one, so nothing is read past the end of the range.
+     */
+    BOOLEVAL_TARGET( "sse4.2" ) [[ nodiscard ]] inline char const * find
+    (
+        char       const * first,
+        char       const * last,
+        char_class const & set
+    ) noexcept
+    {
+        auto const low   { _mm_loadu_si128( reinterpret_cast< __m128i const * >( set.low () ) ) };
+        auto const high  { _mm_loadu_si128( reinterpret_cast< __m128i const * >( set.high() ) ) };
+        auto const nibble{ _mm_set1_epi8( 0x0F ) };
+        auto const zero  { _mm_setzero_si128() };
+
+        for ( ; last - first >= 16; first += 16 )
+        {
+            auto const chunk{ _mm_loadu_si128( reinterpret_cast< __m128i const * >( first ) ) };
+            auto const lo   { _mm_shuffle_epi8( low,  _mm_and_si128( chunk, nibble ) ) };
+            auto const hi   { _mm_shuffle_epi8( high, _mm_and_si128( _mm_srli_epi16( chunk, 4 ), nibble ) ) };
+
+            auto const outside{ static_cast< unsigned >( _mm_movemask_epi8( _mm_cmpeq_epi8( _mm_and_si128( lo, hi ), zero ) ) ) };
+            if ( outside != 0xFFFFu )
+            {
+                return first + lowest_bit( ~outside & 0xFFFFu );
+            }
+        }
+
+        return scalar::find( first, last, set );
+    }
+
+} // namespace sse42
+
+namespace avx2
+{
+
+    /**
+     * Classifies 32 characters at a time, while the rest of the range is left to the
+     * SSE4.2 version. Byte shuffles work within 128-bit lanes, so the nibble tables
+     * are repeated in both lanes.
+     */
+    BOOLEVAL_TARGET( "avx2" ) [[ nodiscard ]] inline char const * find
+    (
+        char       const * first,
+        char       const * last,
+        char_class const & set
+    ) noexcept
+    {
+        auto const low   { _mm256_broadcastsi128_si256( _mm_loadu_si128( reinterpret_cast< __m128i const * >( set.low () ) ) ) };
+        auto const high  { _mm256_broadcastsi128_si256( _mm_loadu_si128( reinterpret_cast< __m128i const * >( set.high() ) ) ) };
+        auto const nibble{ _mm256_set1_epi8( 0x0F ) };
+        auto const zero  { _mm256_setzero_si256() };
+
+        for ( ; last - first >= 32; first += 32 )
+        {
+            auto const chunk{ _mm256_loadu_si256( reinterpret_cast< __m256i const * >( first ) ) };
+            auto const lo   { _mm256_shuffle_epi8( low,  _mm256_and_si256( chunk, nibble ) ) };
+            auto const hi   { _mm256_shuffle_epi8( high, _mm256_and_si256( _mm256_srli_epi16( chunk, 4 ), nibble ) ) };
+
+            auto const outside{ static_cast< std::uint32_t >( _mm256_movemask_epi8( _mm256_cmpeq_epi8( _mm256_and_si256( lo, hi ), zero ) ) ) };
+            if ( outside != 0xFFFFFFFFu )
+            {
+                return first + lowest_bit( ~outside );
+            }
+        }
+
+        return sse42::find( first, last, set );
+    }
+
+} // namespace avx2
+
+#endif // BOOLEVAL_SIMD
+
+/**
+ * Finds the first character of the range that is in the set by using the specified instruction set.
+ *
+ * @param isa   Instruction set to run the search with
+ * @param first Pointer to the first character
+ * @param last  Pointer past the last character
+ * @param set   Set of characters
+ *
+ * @return Pointer to the first character in the set or last if there is none
+ */
+[[ nodiscard ]] inline char const * find
+(
+    [[ maybe_unused ]] instruction_set const   isa,
+                       char            const * first,
+                       char            const * last,
+                       char_class      const & set
+) noexcept
+{
+#if defined( BOOLEVAL_SIMD )
+    switch ( isa )
+    {
+        case instruction_set::avx2 : return avx2 ::find( first, last, set );
+        case instruction_set::sse42: return sse42::find( first, last, set );
+
+        default:
+            break;
+    }
+#endif
+
+    return scalar::find( first, last, set );
+}
+
+} // namespace booleval::utils
+
+#endif // BOOLEVAL_CHAR_CLASS_HPP
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef BOOLEVAL_CONSTANT_HPP
+#define BOOLEVAL_CONSTANT_HPP
+
+#include <limits>
+#include <cstdint>
+#include <charconv>
+#include <functional>
+#include <string_view>
+
+#include <booleval/utils/string_utils.hpp>
+
+namespace booleval::utils
+{
+
+/**
+ * Hashes the integer value. Bits of the value are mixed, so the integers
+ * following some stride, e.g. multiples of 1024, do not collide when only
+ * the lowest bits of the hash are used.
+ *
+ * @param value Integer value
+ *
+ * @return Hash of the value
+ */
+[[ nodiscard ]] constexpr std::size_t hash_integer( std::int64_t const value ) noexcept
+{
+    auto hash{ static_cast< std::uint64_t >( value ) };
+
+    hash = ( hash ^ ( hash >> 30u ) ) * 0xBF58476D1CE4E5B9ULL;
+    hash = ( hash ^ ( hash >> 27u ) ) * 0x94D049BB133111EBULL;
+
+    return static_cast< std::size_t >( hash ^ ( hash >> 31u ) );
+}
+
+/**
+ * Hashes the floating point value with double precision, so all the values
+ * comparing equal as doubles have the same hash.
+ *
+ * @param value Floating point value
+ *
+ * @return Hash of the value
+ */
+[[ nodiscard ]] inline std::size_t hash_double( double const value ) noexcept
+{
+    // zero and negative zero compare equal
+    if ( value == 0. ) { return 0u; }
+
+    return std::hash< double >{}( value );
+}
+
+/**
+ * Hashes the floating point value with single precision, so all the values
+ * comparing equal as floats have the same hash.
+ *
+ * @param value Floating point value
+ *
+ * @return Hash of the value
+ */
+[[ nodiscard ]] inline std::size_t hash_single( double const value ) noexcept
+{
+    constexpr auto max{ static_cast< double >( std::numeric_limits< float >::max() ) };
+    constexpr auto inf{ std::numeric_limits< float >::infinity() };
+
+    // values out of float range would not be representable after the conversion
+    if ( value >  max ) { return std::hash< float >{}(  inf ); }
+    if ( value < -max ) { return std::hash< float >{}( -inf ); }
+
+    // zero and negative zero compare equal
+    if ( value == 0. ) { return 0u; }
+
+    return std::hash< float >{}( static_cast< float >( value ) );
+}
+
+/**
+ * @class constant
+ *
+ * Represents the literal of an expression that is classified and converted
+ * only once, when the expression is compiled, so the literal does not need
+ * to be parsed again on every evaluation.
+ *
+ * Text of the constant is a view into the text of the compiled expression.
+ */
+class constant
+{
+public:
+    /**
+     * Kind of the constant:
+     * - integer:        the whole text is an integer, e.g. "42"
+     * - floating_point: the text starts with a number, e.g. "1.5" or "1U"
+     * - string:         the text is not a number at all, e.g. "foo"
+     */
+    enum class kind : std::uint8_t
+    {
+        string,
+        integer,
+        floating_point
+    };
+
+    constexpr constant() noexcept = default;
+
+    explicit constant( std::string_view const text ) noexcept
+        : text_{ text }
+        , hash_{ std::hash< std::string_view >{}( text ) }
+    {
+        auto const first{ std::data( text )          };
+        auto const last { first + std::size( text ) };
+
+        auto const result{ std::from_chars( first, last, integer_ ) };
+
+        if ( result.ec == std::errc() && result.ptr == last )
+        {
+            kind_   = kind::integer;
+            number_ = static_cast< double >( integer_ );
+        }
+        else if ( auto const number{ utils::from_chars< double >( text ) }; number )
+        {
+            kind_   = kind::floating_point;
+            number_ = number.value();
+        }
+    }
+
+    [[ nodiscard ]] constexpr kind             type()    const noexcept { return kind_;                 }
+    [[ nodiscard ]] constexpr bool             numeric() const noexcept { return kind_ != kind::string; }
+    [[ nodiscard ]] constexpr std::string_view text()    const noexcept { return text_;                 }
+    [[ nodiscard ]] constexpr std::size_t      length()  const noexcept { return std::size( text_ );    }
+    [[ nodiscard ]] constexpr std::size_t      hash()    const noexcept { return hash_;                 }
+    [[ nodiscard ]] constexpr std::int64_t     integer() const noexcept { return integer_;              }
+    [[ nodiscard ]] constexpr double           number()  const noexcept { return number_;               }
+
+private:
+    std::string_view text_   {};
+    std::size_t      hash_   { 0u };
+    std::int64_t     integer_{ 0  };
+    double           number_ { 0. };
+    kind             kind_   { kind::string };
+};
+
+} // namespace booleval::utils
+
+#endif // BOOLEVAL_CONSTANT_HPP
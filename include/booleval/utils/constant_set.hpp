@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef BOOLEVAL_CONSTANT_SET_HPP
+#define BOOLEVAL_CONSTANT_SET_HPP
+
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+#include <booleval/utils/constant.hpp>
+#include <booleval/utils/any_value.hpp>
+
+namespace booleval::utils
+{
+
+/**
+ * @class constant_set
+ *
+ * Represents the set of constants that checks whether the value is equal
+ * to any of them. Its structure depends on the number of constants: small
+ * sets are scanned linearly since their constants are stored contiguously,
+ * while large sets are looked up in the open addressing hash tables, so
+ * the lookup takes constant time regardless of the number of constants.
+ *
+ * String values are looked up by the text of the constants, while numeric
+ * values only by the constants having a numeric value. Each kind of numeric
+ * value has its own table keyed with the precision the value is compared
+ * with, so e.g. large integers do not collide just because they would be
+ * equal after a conversion to float.
+ */
+class constant_set
+{
+public:
+    /**
+     * Maximum number of constants that are scanned linearly.
+     */
+    static constexpr std::size_t linear_scan_limit{ 8u };
+
+    constant_set() = default;
+
+    template< typename InputIt >
+    constant_set( InputIt first, InputIt last )
+    {
+        assign( first, last );
+    }
+
+    /**
+     * Replaces the constants of the set, reusing its storage.
+     *
+     * @param first Iterator to the first constant
+     * @param last  Iterator past the last constant
+     */
+    template< typename InputIt >
+    void assign( InputIt first, InputIt last )
+    {
+        constants_.assign( first, last );
+
+        numeric_ = std::all_of
+        (
+            std::cbegin( constants_ ),
+            std::cend  ( constants_ ),
+            []( auto && constant ) noexcept
+            {
+                return constant.numeric();
+            }
+        );
+
+        fractional_ = std::any_of
+        (
+            std::cbegin( constants_ ),
+            std::cend  ( constants_ ),
+            []( auto && constant ) noexcept
+            {
+                return constant.type() == utils::constant::kind::floating_point;
+            }
+        );
+
+        if ( std::size( constants_ ) > linear_scan_limit )
+        {
+            build();
+        }
+    }
+
+    /**
+     * Checks whether the value is equal to any of the constants.
+     *
+     * @param value Value to look for
+     *
+     * @return True if the value is equal to any of the constants, otherwise false
+     */
+    [[ nodiscard ]] bool contains( any_value const & value ) const noexcept
+    {
+        std::size_t probes{ 0u };
+        return find( value, probes );
+    }
+
+    /**
+     * Checks whether the value is not equal to any of the constants. It is the exact
+     * opposite of the chain of != comparisons, rather than of the contains, since
+     * the values not comparable to some of the constants are not equal to them either.
+     *
+     * @param value Value to look for
+     *
+     * @return True if the value differs from all the constants, otherwise false
+     */
+    [[ nodiscard ]] bool excludes( any_value const & value ) const noexcept
+    {
+        if ( value.type() == any_value::kind::none ) { return false; }
+
+        if ( value.type() != any_value::kind::string && !numeric_ ) { return false; }
+
+        return !contains( value );
+    }
+
+    /**
+     * Gets the number of constants compared with the value while looking it up.
+     * It stays small for the large sets as long as the hash tables are well
+     * distributed.
+     *
+     * @param value Value to look for
+     *
+     * @return Number of constants compared with the value
+     */
+    [[ nodiscard ]] std::size_t probes( any_value const & value ) const noexcept
+    {
+        std::size_t probes{ 0u };
+        static_cast< void >( find( value, probes ) );
+        return probes;
+    }
+
+    [[ nodiscard ]] std::size_t size () const noexcept { return std::size( constants_ ); }
+    [[ nodiscard ]] bool        empty() const noexcept { return constants_.empty();      }
+
+    [[ nodiscard ]] auto begin() const noexcept { return std::cbegin( constants_ ); }
+    [[ nodiscard ]] auto end  () const noexcept { return std::cend  ( constants_ ); }
+
+private:
+    static constexpr std::uint32_t empty_slot{ std::numeric_limits< std::uint32_t >::max() };
+
+    using table = std::vector< std::uint32_t >;
+
+    [[ nodiscard ]] bool find( any_value const & value, std::size_t & probes ) const noexcept
+    {
+        if ( std::size( constants_ ) <= linear_scan_limit )
+        {
+            for ( auto const & constant : constants_ )
+            {
+                ++probes;
+                if ( value == constant ) { return true; }
+            }
+
+            return false;
+        }
+
+        switch ( value.type() )
+        {
+            case any_value::kind::string:
+                return probe( strings_, value.hash(), value, probes );
+
+            case any_value::kind::signed_integer:
+            case any_value::kind::unsigned_integer:
+                // integers are compared with the floating point constants as doubles
+                return probe( integers_, value.hash(), value, probes ) ||
+                       ( fractional_ && probe( doubles_, hash_double( value.number() ), value, probes ) );
+
+            case any_value::kind::single_precision:
+                return probe( singles_, value.hash(), value, probes );
+
+            case any_value::kind::double_precision:
+                return probe( doubles_, value.hash(), value, probes );
+
+            default:
+                return false;
+        }
+    }
+
+    [[ nodiscard ]] bool probe
+    (
+        table       const & slots,
+        std::size_t const   hash,
+        any_value   const & value,
+        std::size_t       & probes
+    ) const noexcept
+    {
+        for ( auto slot{ hash & mask_ }; slots[ slot ] != empty_slot; slot = ( slot + 1 ) & mask_ )
+        {
+            ++probes;
+            if ( value == constants_[ slots[ slot ] ] ) { return true; }
+        }
+
+        return false;
+    }
+
+    /**
+     * Builds the hash tables with the load factor of at most one half,
+     * so the probe sequences stay short.
+     */
+    void build()
+    {
+        std::size_t capacity{ 1u };
+        while ( capacity < 2u * std::size( constants_ ) ) { capacity <<= 1u; }
+
+        mask_ = capacity - 1u;
+        strings_ .assign( capacity, empty_slot );
+        integers_.assign( capacity, empty_slot );
+        singles_ .assign( capacity, empty_slot );
+        doubles_ .assign( capacity, empty_slot );
+
+        for ( std::uint32_t i{ 0u }; i < std::size( constants_ ); ++i )
+        {
+            auto const & constant{ constants_[ i ] };
+
+            insert( strings_, constant.hash(), i );
+
+            if ( constant.type() == utils::constant::kind::integer )
+            {
+                insert( integers_, hash_integer( constant.integer() ), i );
+            }
+
+            if ( constant.numeric() )
+            {
+                insert( singles_, hash_single( constant.number() ), i );
+                insert( doubles_, hash_double( constant.number() ), i );
+            }
+        }
+    }
+
+    void insert( table & slots, std::size_t const hash, std::uint32_t const index ) noexcept
+    {
+        auto slot{ hash & mask_ };
+        while ( slots[ slot ] != empty_slot ) { slot = ( slot + 1 ) & mask_; }
+
+        slots[ slot ] = index;
+    }
+
+private:
+    std::vector< constant > constants_ {};
+    table                   strings_   {};
+    table                   integers_  {};
+    table                   singles_   {};
+    table                   doubles_   {};
+    std::size_t             mask_      { 0u };
+    bool                    numeric_   { true };
+    bool                    fractional_{ false };
+};
+
+} // namespace booleval::utils
+
+#endif // BOOLEVAL_CONSTANT_SET_HPP
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef BOOLEVAL_INSTRUCTION_SET_HPP
+#define BOOLEVAL_INSTRUCTION_SET_HPP
+
+#include <cstdint>
+
+// SIMD kernels are compiled for x86 only, unless disabled by defining BOOLEVAL_NO_SIMD
+#if !defined( BOOLEVAL_NO_SIMD ) && ( defined( __x86_64__ ) || defined( __i386__ ) || defined( _M_X64 ) || defined( _M_IX86 ) )
+#define BOOLEVAL_SIMD
+#include <immintrin.h>
+#if defined( _MSC_VER ) && !defined( __clang__ )
+#include <intrin.h>
+#endif
+#endif
+
+// functions using instructions the rest of the code is not compiled for, so they are called only if supported
+#if defined( __GNUC__ ) || defined( __clang__ )
+#define BOOLEVAL_TARGET( isa ) __attribute__(( target( isa ) ))
+#else
+#define BOOLEVAL_TARGET( isa )
+#endif
+
+namespace booleval::utils
+{
+
+/**
+ * enum class instruction_set
+ *
+ * Represents the instruction set the vectorized code paths are run with.
+ */
+enum class [[ nodiscard ]] instruction_set : std::uint8_t
+{
+    scalar,
+    sse42,
+    avx2
+};
+
+/**
+ * Detects the best instruction set supported by the CPU, as well as by the operating system.
+ *
+ * @return Instruction set
+ */
+[[ nodiscard ]] inline instruction_set detect_instruction_set() noexcept
+{
+#if defined( BOOLEVAL_SIMD )
+#if defined( __GNUC__ ) || defined( __clang__ )
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports( "avx2"   ) ) { return instruction_set::avx2;  }
+    if ( __builtin_cpu_supports( "sse4.2" ) ) { return instruction_set::sse42; }
+#elif defined( _MSC_VER )
+    int info[ 4 ]{};
+    __cpuid( info, 0 );
+    auto const leaves{ info[ 0 ] };
+
+    __cpuid( info, 1 );
+    auto const sse42  { ( info[ 2 ] & ( 1 << 20 ) ) != 0 };
+    auto const osxsave{ ( info[ 2 ] & ( 1 << 27 ) ) != 0 };
+    auto const avx    { ( info[ 2 ] & ( 1 << 28 ) ) != 0 };
+
+    // operating system has to save the AVX registers as well
+    if ( leaves >= 7 && osxsave && avx && ( _xgetbv( 0 ) & 6u ) == 6u )
+    {
+        __cpuidex( info, 7, 0 );
+        if ( ( info[ 1 ] & ( 1 << 5 ) ) != 0 ) { return instruction_set::avx2; }
+    }
+
+    if ( sse42 ) { return instruction_set::sse42; }
+#endif
+#endif
+
+    return instruction_set::scalar;
+}
+
+/**
+ * Gets the best instruction set supported, detected only once.
+ *
+ * @return Instruction set
+ */
+[[ nodiscard ]] inline instruction_set supported_instruction_set() noexcept
+{
+    static instruction_set const supported{ detect_instruction_set() };
+    return supported;
+}
+
+} // namespace booleval::utils
+
+#endif // BOOLEVAL_INSTRUCTION_SET_HPP
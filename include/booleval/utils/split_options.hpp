@@ -46,7 +46,8 @@ enum class [[ nodiscard ]] split_options : std::uint8_t
     include_delimiters   = 0x01,
     exclude_delimiters   = 0x02,
     split_by_whitespace  = 0x04,
-    allow_quoted_strings = 0x08
+    allow_quoted_strings = 0x08,
+    vectorized           = 0x10
 };
 
 template< typename EnumT >
@@ -34,8 +34,10 @@
 #include <algorithm>
 #include <string_view>
 
+#include <booleval/utils/char_class.hpp>
 #include <booleval/utils/split_options.hpp>
 #include <booleval/utils/string_utils.hpp>
+#include <booleval/utils/instruction_set.hpp>
 
 namespace booleval::utils
 {
@@ -49,6 +51,9 @@ constexpr auto double_quote_char{ '\"' };
  *
  * Represents the range of tokens computed by splitting the given
  * string view by the specified delimiters.
+ *
+ * With the vectorized option, token boundaries are searched for 16 or 32 characters
+ * at a time by using SSE4.2 or AVX2 instructions, if the CPU supports them.
  */
 template
 <
@@ -86,6 +91,11 @@ public:
             , delims_{ delims              }
             , prev_  { std::begin( strv_ ) }
         {
+            if constexpr ( is_set( iterator_options, split_options::vectorized ) )
+            {
+                vectorized_ = classify();
+            }
+
             next();
         }
 
@@ -153,6 +163,8 @@ public:
 
         /**
          * Finds the iterator pointing to the beginning of the next token in the specified range.
+         * The range is examined only up to the first delimiter or quote character, so splitting
+         * the whole string takes linear time regardless of how rare the delimiters are.
          *
          * @param first Iterator to the first element of the range to examine
          * @param last  Iterator to the last element of the range to examine
@@ -165,51 +177,106 @@ public:
             std::string_view::iterator const last
         ) const noexcept
         {
+            if constexpr ( is_set( iterator_options, split_options::vectorized ) )
+            {
+                if ( vectorized_ )
+                {
+                    return find_vectorized( first, last, curr_value_.is_quoted ? quotes_ : boundaries_ );
+                }
+            }
+
             if constexpr ( is_set( iterator_options, split_options::allow_quoted_strings ) )
             {
                 if ( curr_value_.is_quoted )
                 {
                     return find_next_quote( first, last );
                 }
-                else
+            }
+
+            return std::find_if
+            (
+                first,
+                last,
+                [ this ]( char const c ) noexcept
                 {
-                    return std::min
-                    (
-                        find_next_quote( first, last ),
-                        find_next_delim( first, last )
-                    );
+                    return is_boundary( c );
                 }
+            );
+        }
+
+        /**
+         * Builds the sets of the characters ending the unquoted and the quoted token
+         * for the vectorized search and picks the instruction set to run it with.
+         *
+         * @return True if all the characters fit into the sets, false otherwise
+         */
+        [[ nodiscard ]] bool classify() noexcept
+        {
+            for ( auto const c : delims_ )
+            {
+                if ( !boundaries_.insert( c ) ) { return false; }
             }
-            else
+
+            if constexpr ( is_set( iterator_options, split_options::allow_quoted_strings ) )
             {
-                return find_next_delim( first, last );
+                if ( !boundaries_.insert( iterator_quote_char ) || !quotes_.insert( iterator_quote_char ) ) { return false; }
             }
+
+            if constexpr ( is_set( iterator_options, split_options::split_by_whitespace ) )
+            {
+                if ( !boundaries_.insert( whitespace_char ) ) { return false; }
+            }
+
+            isa_ = supported_instruction_set();
+            return true;
         }
 
         /**
-         * Finds the iterator pointing to the first delimiter in the specified range.
+         * Finds the first character of the range that is in the specified set by
+         * examining as many characters at a time as the instruction set allows.
          *
          * @param first Iterator to the first element of the range to examine
          * @param last  Iterator to the last element of the range to examine
+         * @param set   Set of the characters ending the token
          *
-         * @return Iterator to the first delimiter
+         * @return Iterator to the first character in the set or last if there is none
          */
-        [[ nodiscard ]] constexpr std::string_view::iterator find_next_delim
+        [[ nodiscard ]] std::string_view::iterator find_vectorized
         (
-            std::string_view::iterator const first,
-            std::string_view::iterator const last
+            std::string_view::iterator const   first,
+            std::string_view::iterator const   last,
+            char_class                 const & set
         ) const noexcept
         {
-            if constexpr ( is_set( iterator_options, split_options::split_by_whitespace ) )
+            auto const begin{ std::begin( strv_ ) };
+            auto const data { std::data ( strv_ ) };
+
+            auto const found{ utils::find( isa_, data + ( first - begin ), data + ( last - begin ), set ) };
+
+            return begin + ( found - data );
+        }
+
+        /**
+         * Checks whether the character ends the token, i.e. whether it is one of the
+         * delimiters or, depending on the options, the whitespace or the quote character.
+         *
+         * @param c Character to examine
+         *
+         * @return True if the character ends the token, false otherwise
+         */
+        [[ nodiscard ]] constexpr bool is_boundary( char const c ) const noexcept
+        {
+            if constexpr ( is_set( iterator_options, split_options::allow_quoted_strings ) )
             {
-                auto const whitespace { std::find( first, last, whitespace_char ) };
-                auto const other_delim{ std::find_first_of( first, last, std::begin( delims_ ), std::end( delims_ ) ) };
-                return std::min( whitespace, other_delim );
+                if ( c == iterator_quote_char ) { return true; }
             }
-            else
+
+            if constexpr ( is_set( iterator_options, split_options::split_by_whitespace ) )
             {
-                return std::find_first_of( first, last, std::begin( delims_ ), std::end( delims_ ) );
+                if ( c == whitespace_char ) { return true; }
             }
+
+            return delims_.find( c ) != std::string_view::npos;
         }
 
         /**
@@ -294,6 +361,12 @@ public:
         std::string_view::iterator curr_;
 
         value_type curr_value_{};
+
+        // used only with the vectorized option
+        char_class      boundaries_{};
+        char_class      quotes_    {};
+        instruction_set isa_       { instruction_set::scalar };
+        bool            vectorized_{ false };
     };
 
 public:
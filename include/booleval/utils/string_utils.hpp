@@ -214,6 +214,14 @@ template
 >
 [[ nodiscard ]] std::optional< T > from_chars( std::string_view const strv ) noexcept
 {
+    // extraction fails right away unless the number starts with a digit, sign or decimal point,
+    // so the stream is not even created for the values that are obviously not numbers
+    auto const first{ strv.find_first_not_of( " \t\n\v\f\r" ) };
+    if ( first == std::string_view::npos || std::string_view{ "+-.0123456789" }.find( strv[ first ] ) == std::string_view::npos )
+    {
+        return std::nullopt;
+    }
+
     T value{};
 
     std::stringstream ss;
@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <limits>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <string_view>
+#include <gtest/gtest.h>
+
+#include <booleval/tree/tree.hpp>
+#include <booleval/tree/arena.hpp>
+#include <booleval/token/token_type.hpp>
+#include <booleval/bytecode/program.hpp>
+#include <booleval/bytecode/compiler.hpp>
+#include <booleval/utils/string_utils.hpp>
+
+TEST( CompilerTest, EmptyTree )
+{
+    booleval::tree::arena       arena;
+    booleval::bytecode::program program;
+
+    ASSERT_FALSE( booleval::bytecode::compile( arena, program ) );
+    ASSERT_TRUE ( program.empty()                               );
+}
+
+TEST( CompilerTest, RelationalOperation )
+{
+    using namespace booleval;
+
+    tree::arena       arena;
+    bytecode::program program;
+
+    ASSERT_TRUE( tree::build( "field_a gt 1", arena ) );
+    ASSERT_TRUE( bytecode::compile( arena, program ) );
+    ASSERT_EQ  ( program.size(), 1u                  );
+
+    ASSERT_EQ( program[ 0 ].code, bytecode::opcode::test                   );
+    ASSERT_EQ( program[ 0 ].relation, token::token_type::gt                );
+    ASSERT_EQ( program.field  ( program[ 0 ].operand ), "field_a"          );
+    ASSERT_EQ( program.literal( program[ 0 ].literal ).text(), "1"         );
+    ASSERT_EQ( program.literal( program[ 0 ].literal ).type(), utils::constant::kind::integer );
+}
+
+TEST( CompilerTest, SetOperation )
+{
+    using namespace booleval;
+
+    tree::arena       arena;
+    bytecode::program program;
+
+    ASSERT_TRUE( tree::build( "field_a not in (1, foo, 2.5)", arena ) );
+    ASSERT_TRUE( bytecode::compile( arena, program )                 );
+    ASSERT_EQ  ( program.size(), 1u                                  );
+
+    ASSERT_EQ( program[ 0 ].code, bytecode::opcode::test          );
+    ASSERT_EQ( program[ 0 ].relation, token::token_type::not_in   );
+    ASSERT_EQ( program.field( program[ 0 ].operand ), "field_a"   );
+    ASSERT_EQ( program.set  ( program[ 0 ].literal ).size(), 3u   );
+}
+
+TEST( CompilerTest, Parameters )
+{
+    using namespace booleval;
+
+    tree::arena       arena;
+    bytecode::program program;
+
+    ASSERT_TRUE( tree::build( "field_a gt ? and field_b in (?)", arena ) );
+    ASSERT_TRUE( bytecode::compile( arena, program )                     );
+
+    ASSERT_EQ   ( program.parameters(), 2u );
+    ASSERT_FALSE( program.ready()          );
+
+    std::vector< std::string_view > const values{ "foo", "bar" };
+
+    // parameter kind has to match
+    ASSERT_FALSE( program.parameter( 0, std::cbegin( values ), std::cend( values ) ) );
+    ASSERT_FALSE( program.parameter( 1, 5 )                                           );
+    ASSERT_FALSE( program.parameter( 2, 5 )                                           );
+
+    ASSERT_TRUE ( program.parameter( 0, 2.5 )                                    );
+    ASSERT_EQ   ( program.literal( program[ 0 ].literal ).number(), 2.5          );
+    ASSERT_FALSE( program.ready()                                                );
+
+    ASSERT_TRUE ( program.parameter( 1, std::cbegin( values ), std::cend( values ) ) );
+    ASSERT_TRUE ( program.ready()                                                     );
+
+    auto const & set{ program.set( program[ 2 ].literal ) };
+    ASSERT_EQ  ( set.size(), 2u                                   );
+    ASSERT_TRUE( set.contains( utils::any_value{ "bar" } )        );
+}
+
+TEST( CompilerTest, FloatingPointParameters )
+{
+    using namespace booleval;
+
+    tree::arena       arena;
+    bytecode::program program;
+
+    ASSERT_TRUE( tree::build( "field_a eq ?", arena ) );
+    ASSERT_TRUE( bytecode::compile( arena, program ) );
+
+    ASSERT_TRUE( program.parameter( 0, 2.5F )                           );
+    ASSERT_EQ  ( program.literal( program[ 0 ].literal ).text(), "2.5" );
+
+    ASSERT_TRUE( program.parameter( 0, -0.125 )                            );
+    ASSERT_EQ  ( program.literal( program[ 0 ].literal ).text(), "-0.125" );
+
+    // long double values are written in their own precision
+    auto const value{ 1.L + std::numeric_limits< long double >::epsilon() };
+    ASSERT_TRUE( program.parameter( 0, value ) );
+
+    auto const text{ program.literal( program[ 0 ].literal ).text() };
+    ASSERT_EQ( utils::from_chars< long double >( text ), value );
+}
+
+TEST( CompilerTest, LogicalChain )
+{
+    using namespace booleval;
+
+    tree::arena       arena;
+    bytecode::program program;
+
+    ASSERT_TRUE( tree::build( "field_a 1 or field_b 2 or field_a 3", arena ) );
+    ASSERT_TRUE( bytecode::compile( arena, program )                      );
+    ASSERT_EQ  ( program.size(), 5u                                       );
+
+    ASSERT_EQ( program[ 0 ].code, bytecode::opcode::test         );
+    ASSERT_EQ( program[ 1 ].code, bytecode::opcode::jump_if_true );
+    ASSERT_EQ( program[ 2 ].code, bytecode::opcode::test         );
+    ASSERT_EQ( program[ 3 ].code, bytecode::opcode::jump_if_true );
+    ASSERT_EQ( program[ 4 ].code, bytecode::opcode::test         );
+
+    // all operands jump straight to the end of the chain
+    ASSERT_EQ( program[ 1 ].operand, 5u );
+    ASSERT_EQ( program[ 3 ].operand, 5u );
+
+    // field names are shared between instructions
+    ASSERT_EQ( program[ 0 ].operand, program[ 4 ].operand );
+    ASSERT_NE( program[ 0 ].operand, program[ 2 ].operand );
+}
+
+TEST( CompilerTest, JumpThreading )
+{
+    using namespace booleval;
+
+    tree::arena       arena;
+    bytecode::program program;
+
+    ASSERT_TRUE( tree::build( "(field_a 1 and field_b 2) or field_c 3", arena ) );
+    ASSERT_TRUE( bytecode::compile( arena, program )                         );
+    ASSERT_EQ  ( program.size(), 5u                                          );
+
+    ASSERT_EQ( program[ 1 ].code, bytecode::opcode::jump_if_false );
+    ASSERT_EQ( program[ 3 ].code, bytecode::opcode::jump_if_true  );
+
+    // false 'and' skips the 'or' jump and continues with its right operand
+    ASSERT_EQ( program[ 1 ].operand, 4u );
+    ASSERT_EQ( program[ 3 ].operand, 5u );
+}
+
+TEST( CompilerTest, MemoSlots )
+{
+    using namespace booleval;
+
+    tree::arena       arena;
+    bytecode::program program;
+
+    ASSERT_TRUE( tree::build( "(field_a foo and field_b 1) or (field_c 2 and field_a bar)", arena ) );
+    ASSERT_TRUE( bytecode::compile( arena, program )                                                );
+
+    // only field_a is tested more than once
+    std::vector< std::uint8_t > slots;
+    for ( auto const & instruction : program )
+    {
+        if ( instruction.code == bytecode::opcode::test ) { slots.push_back( instruction.slot ); }
+    }
+
+    ASSERT_EQ
+    (
+        slots,
+        ( std::vector< std::uint8_t >{ 0u, bytecode::instruction::no_slot, bytecode::instruction::no_slot, 0u } )
+    );
+}
+
+TEST( CompilerTest, NoMemoSlotsForExclusiveTests )
+{
+    using namespace booleval;
+
+    // the second test of field 0 is never run after the first one
+    bytecode::program program;
+    program.emit( { bytecode::opcode::test,          token::token_type::eq } );
+    program.emit( { bytecode::opcode::jump_if_true,  token::token_type::unknown, bytecode::instruction::no_slot, 5u } );
+    program.emit( { bytecode::opcode::jump_if_false, token::token_type::unknown, bytecode::instruction::no_slot, 4u } );
+    program.emit( { bytecode::opcode::test,          token::token_type::eq } );
+    program.emit( { bytecode::opcode::test,          token::token_type::eq, bytecode::instruction::no_slot, 1u } );
+    program.emit( { bytecode::opcode::test,          token::token_type::eq, bytecode::instruction::no_slot, 1u } );
+
+    bytecode::internal::memoize( program );
+
+    // field 1 is tested twice when the first test fails
+    ASSERT_EQ( program[ 0 ].slot, bytecode::instruction::no_slot );
+    ASSERT_EQ( program[ 3 ].slot, bytecode::instruction::no_slot );
+    ASSERT_EQ( program[ 4 ].slot, 0u                             );
+    ASSERT_EQ( program[ 5 ].slot, 0u                             );
+}
+
+TEST( CompilerTest, MemoSlotsForMostTestedFields )
+{
+    using namespace booleval;
+
+    tree::arena       arena;
+    bytecode::program program;
+
+    std::string left { "field_8 1" };
+    std::string right{ "field_8 2" };
+    for ( char i{ '0' }; i < '8'; ++i )
+    {
+        left  += std::string{ " and field_" } + i + " 1";
+        right += std::string{ " and field_" } + i + " 2";
+    }
+
+    auto const expression{ "(" + left + ") or (" + right + ") or field_9 1 or field_8 3" };
+
+    ASSERT_TRUE( tree::build( expression, arena )    );
+    ASSERT_TRUE( bytecode::compile( arena, program ) );
+
+    // field_8 is tested three times, so it takes a slot before the fields tested twice
+    std::size_t memoized{ 0u };
+    for ( auto const & instruction : program )
+    {
+        if ( instruction.code != bytecode::opcode::test ) { continue; }
+
+        if ( program.field( instruction.operand ) == "field_8" )
+        {
+            ASSERT_NE( instruction.slot, bytecode::instruction::no_slot );
+        }
+        if ( instruction.slot != bytecode::instruction::no_slot ) { ++memoized; }
+    }
+    ASSERT_EQ( memoized, 3u + 7u * 2u );
+}
+
+TEST( CompilerTest, MissingOperand )
+{
+    using namespace booleval;
+
+    tree::arena       arena;
+    bytecode::program program;
+
+    arena.root( arena.emplace( token::token_type::logical_or ) );
+
+    ASSERT_TRUE( bytecode::compile( arena, program )                        );
+    ASSERT_EQ  ( program.size(), 1u                                         );
+    ASSERT_EQ  ( program[ 0 ].code, bytecode::opcode::fail                  );
+    ASSERT_EQ  ( program.message( program[ 0 ].operand ), "Missing operand" );
+}
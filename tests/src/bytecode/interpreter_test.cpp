@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <array>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <gtest/gtest.h>
+
+#include <booleval/field.hpp>
+#include <booleval/tree/tree.hpp>
+#include <booleval/tree/arena.hpp>
+#include <booleval/tree/result_visitor.hpp>
+#include <booleval/bytecode/program.hpp>
+#include <booleval/bytecode/compiler.hpp>
+#include <booleval/bytecode/interpreter.hpp>
+#include <booleval/utils/bitmap.hpp>
+
+namespace
+{
+
+    template< typename T, typename U >
+    class bar
+    {
+    public:
+        bar( T && value_1, U && value_2 )
+        : value_1_{ value_1 }
+        , value_2_{ value_2 }
+        {}
+
+        T value_1() const noexcept { return value_1_; }
+        U value_2() const noexcept { return value_2_; }
+
+    private:
+        T value_1_{};
+        U value_2_{};
+    };
+
+} // namespace
+
+TEST( InterpreterTest, EmptyProgram )
+{
+    using namespace booleval;
+
+    bytecode::program     program;
+    bytecode::interpreter interpreter;
+
+    auto const result{ interpreter.run( program, bar< std::string, unsigned >{ "foo", 1 } ) };
+    ASSERT_FALSE( result.success         );
+    ASSERT_TRUE ( result.message.empty() );
+}
+
+TEST( InterpreterTest, Bind )
+{
+    using namespace booleval;
+
+    using object = bar< std::string, unsigned >;
+
+    tree::arena           arena;
+    bytecode::program     program;
+    bytecode::interpreter interpreter;
+
+    ASSERT_TRUE( tree::build( "field_2 1 and field_1 foo", arena ) );
+    ASSERT_TRUE( bytecode::compile( arena, program )              );
+    ASSERT_EQ  ( program.binding( 0 ), bytecode::program::unbound );
+    ASSERT_EQ  ( program.binding( 1 ), bytecode::program::unbound );
+
+    interpreter.fields
+    (
+        {
+            make_field( "field_1", &object::value_1 ),
+            make_field( "field_2", &object::value_2 )
+        }
+    );
+
+    ASSERT_TRUE( interpreter.bind( program ) );
+    ASSERT_EQ  ( program.binding( 0 ), 1u    );
+    ASSERT_EQ  ( program.binding( 1 ), 0u    );
+
+    object obj{ "foo", 1 };
+    ASSERT_TRUE( interpreter.run( program, obj ).success );
+
+    interpreter.fields
+    (
+        {
+            make_field( "field_2", &object::value_2 )
+        }
+    );
+
+    ASSERT_FALSE( interpreter.bind( program )                     );
+    ASSERT_EQ   ( program.binding( 0 ), 0u                        );
+    ASSERT_EQ   ( program.binding( 1 ), bytecode::program::unbound );
+
+    auto const result{ interpreter.run( program, obj ) };
+    ASSERT_FALSE( result.success                  );
+    ASSERT_EQ   ( result.message, "Unknown field" );
+}
+
+TEST( InterpreterTest, FieldsFetchedOnce )
+{
+    using namespace booleval;
+
+    struct counted
+    {
+        std::string value_1;
+        unsigned    value_2;
+
+        mutable unsigned calls_1{ 0u };
+        mutable unsigned calls_2{ 0u };
+
+        std::string get_1() const { ++calls_1; return value_1; }
+        unsigned    get_2() const { ++calls_2; return value_2; }
+    };
+
+    tree::arena           arena;
+    bytecode::program     program;
+    bytecode::interpreter interpreter;
+
+    interpreter.fields
+    (
+        {
+            make_field( "field_1", &counted::get_1 ),
+            make_field( "field_2", &counted::get_2 )
+        }
+    );
+
+    ASSERT_TRUE( tree::build( "(field_1 foo and field_2 1) or (field_1 qux and field_2 2)", arena ) );
+    ASSERT_TRUE( bytecode::compile( arena, program )                                               );
+    ASSERT_TRUE( interpreter.bind( program )                                                       );
+
+    counted x{ "qux", 2 };
+    ASSERT_TRUE( interpreter.run( program, x ).success );
+    ASSERT_EQ  ( x.calls_1, 1u                         );
+    ASSERT_EQ  ( x.calls_2, 1u                         );
+
+    counted y{ "foo", 2 };
+    ASSERT_FALSE( interpreter.run( program, y ).success );
+    ASSERT_EQ   ( y.calls_1, 1u                         );
+    ASSERT_EQ   ( y.calls_2, 1u                         );
+
+    // field_2 is fetched only when it is needed for the first time
+    counted z{ "bar", 1 };
+    ASSERT_FALSE( interpreter.run( program, z ).success );
+    ASSERT_EQ   ( z.calls_1, 1u                         );
+    ASSERT_EQ   ( z.calls_2, 0u                         );
+
+    // memoized values are not kept between the runs
+    ASSERT_TRUE( interpreter.run( program, x ).success );
+    ASSERT_EQ  ( x.calls_1, 2u                         );
+}
+
+TEST( InterpreterTest, SameResultAsTreeEngine )
+{
+    using namespace booleval;
+
+    using object = bar< std::string, unsigned >;
+
+    std::array objects
+    {
+        object{ "foo", 1 },
+        object{ "bar", 2 },
+        object{ "baz", 3 },
+        object{ "qux", 4 }
+    };
+
+    std::array expressions
+    {
+        "field_1 foo",
+        "field_1 neq foo",
+        "field_2 gt 1 and field_2 lt 4",
+        "field_2 geq 2 or field_1 foo",
+        "field_2 leq 1 or field_2 geq 4",
+        "(field_1 foo and field_2 1) or (field_1 qux and field_2 4)",
+        "(field_1 foo or field_1 bar) and (field_2 2 or field_2 1)",
+        "field_1 foo or field_1 bar or field_1 baz or field_1 qux",
+        "field_1 foo and field_2 1 and field_1 bar",
+        "unknown 1 or field_2 2",
+        "field_2 2 or unknown 1",
+        "field_2 2 and unknown 1",
+        "(unknown 1 and field_2 1) or field_1 qux",
+        "field_1 and field_2",
+        "field_1 foo or field_1 ( field_2",
+        "field_1 in (foo, baz)",
+        "field_1 not in (foo, baz) and field_2 in (2, 3, 4)",
+        "field_2 in (1, 2, 3, 4, 5, 6, 7, 8, 9, 10) and field_1 not in (a, b, c, d, e, f, g, h, bar)",
+        "unknown in (1) or field_2 not in (4)",
+    };
+
+    tree::result_visitor visitor;
+    visitor.fields
+    (
+        {
+            make_field( "field_1", &object::value_1 ),
+            make_field( "field_2", &object::value_2 )
+        }
+    );
+
+    bytecode::interpreter interpreter;
+    interpreter.fields
+    (
+        {
+            make_field( "field_1", &object::value_1 ),
+            make_field( "field_2", &object::value_2 )
+        }
+    );
+
+    tree::arena       arena;
+    bytecode::program program;
+
+    for ( std::string_view const expression : expressions )
+    {
+        ASSERT_TRUE( tree::build( expression, arena )    ) << expression;
+        ASSERT_TRUE( bytecode::compile( arena, program ) ) << expression;
+
+        // unknown fields stay unbound and are reported while running the program
+        ASSERT_EQ( interpreter.bind( program ), expression.find( "unknown" ) == std::string_view::npos ) << expression;
+
+        for ( auto & obj : objects )
+        {
+            auto const expected{ visitor.visit( arena, obj )      };
+            auto const actual  { interpreter.run( program, obj ) };
+
+            ASSERT_EQ( actual.success, expected.success ) << expression;
+            ASSERT_EQ( actual.message, expected.message ) << expression;
+        }
+    }
+}
+
+TEST( InterpreterTest, BatchSameResultAsRun )
+{
+    using namespace booleval;
+
+    using object = bar< std::string, unsigned >;
+
+    std::array names{ "foo", "bar", "baz", "qux" };
+
+    std::vector< object > objects;
+    for ( unsigned i{ 0u }; i < 5000u; ++i )
+    {
+        objects.emplace_back( names[ i % std::size( names ) ], i % 5u );
+    }
+
+    std::array expressions
+    {
+        "field_1 foo",
+        "field_2 gt 1 and field_2 lt 4",
+        "(field_1 foo and field_2 1) or (field_1 qux and field_2 4)",
+        "(field_1 foo or field_1 bar) and (field_2 2 or field_2 1)",
+        "field_1 foo and field_2 1 and field_1 bar",
+        "field_1 not in (foo, baz) and field_2 in (2, 3, 4)",
+        "unknown 1 or field_2 2",
+        "field_2 2 and unknown 1",
+        "field_1 and field_2",
+    };
+
+    bytecode::interpreter interpreter;
+    interpreter.fields
+    (
+        {
+            make_field( "field_1", &object::value_1 ),
+            make_field( "field_2", &object::value_2 )
+        }
+    );
+
+    tree::arena       arena;
+    bytecode::program program;
+    utils::bitmap     selection;
+
+    for ( std::string_view const expression : expressions )
+    {
+        ASSERT_TRUE( tree::build( expression, arena )    ) << expression;
+        ASSERT_TRUE( bytecode::compile( arena, program ) ) << expression;
+
+        static_cast< void >( interpreter.bind( program ) );
+
+        // sizes crossing the word and the chunk boundaries
+        for ( std::size_t const size : { 0u, 1u, 64u, 65u, 4096u, 5000u } )
+        {
+            ASSERT_TRUE( interpreter.run( program, std::data( objects ), size, selection ) ) << expression;
+            ASSERT_EQ  ( selection.size(), size                                            ) << expression;
+
+            for ( std::size_t i{ 0u }; i < size; ++i )
+            {
+                ASSERT_EQ( selection.test( i ), interpreter.run( program, objects[ i ] ).success ) << expression << " " << i;
+            }
+        }
+    }
+}
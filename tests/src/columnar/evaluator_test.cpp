@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <array>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <gtest/gtest.h>
+#include <booleval/evaluator.hpp>
+#include <booleval/columnar/evaluator.hpp>
+
+namespace
+{
+
+    struct trade
+    {
+        std::int32_t id;
+        std::int64_t volume;
+        double       price;
+        std::string  venue;
+
+        std::int32_t     get_id    () const noexcept { return id;     }
+        std::int64_t     get_volume() const noexcept { return volume; }
+        double           get_price () const noexcept { return price;  }
+        std::string_view get_venue () const noexcept { return venue;  }
+    };
+
+    /**
+     * Trades stored both as the objects and as the columns.
+     */
+    class trades
+    {
+    public:
+        explicit trades( std::size_t const size )
+        {
+            std::array venues{ "xnas", "xnys", "bats", "" };
+
+            offsets_.push_back( 0u );
+            for ( std::size_t i{ 0u }; i < size; ++i )
+            {
+                trade t
+                {
+                    static_cast< std::int32_t >( i % 10u ) - 3,
+                    static_cast< std::int64_t >( i * 100u ),
+                    90.0 + static_cast< double >( i % 20u ) * 0.5,
+                    venues[ i % std::size( venues ) ]
+                };
+
+                ids_    .push_back( t.id     );
+                volumes_.push_back( t.volume );
+                prices_ .push_back( t.price  );
+                bytes_  .append   ( t.venue  );
+                offsets_.push_back( static_cast< std::uint32_t >( std::size( bytes_ ) ) );
+                objects_.push_back( std::move( t ) );
+            }
+        }
+
+        [[ nodiscard ]] std::vector< trade > const & objects() const noexcept { return objects_; }
+
+        [[ nodiscard ]] booleval::columnar::batch columns( std::size_t const size ) const
+        {
+            return
+            {
+                size,
+                {
+                    std::data( ids_     ),
+                    std::data( volumes_ ),
+                    std::data( prices_  ),
+                    { std::data( offsets_ ), std::data( bytes_ ) }
+                }
+            };
+        }
+
+    private:
+        std::vector< trade         > objects_{};
+        std::vector< std::int32_t  > ids_    {};
+        std::vector< std::int64_t  > volumes_{};
+        std::vector< double        > prices_ {};
+        std::vector< std::uint32_t > offsets_{};
+        std::string                  bytes_  {};
+    };
+
+    booleval::columnar::evaluator make_evaluator()
+    {
+        return
+        {
+            { "id",     booleval::columnar::column_type::int32   },
+            { "volume", booleval::columnar::column_type::int64   },
+            { "price",  booleval::columnar::column_type::float64 },
+            { "venue",  booleval::columnar::column_type::string  }
+        };
+    }
+
+} // namespace
+
+TEST( ColumnarEvaluatorTest, NotActivated )
+{
+    trades const data{ 10u };
+
+    auto evaluator{ make_evaluator() };
+
+    booleval::utils::bitmap selection;
+    ASSERT_FALSE( evaluator.evaluate( data.columns( 10u ), selection ) );
+    ASSERT_EQ   ( selection.size(), 10u                               );
+
+    ASSERT_FALSE( evaluator.expression( "id 1 and unknown 2" ) );
+    ASSERT_FALSE( evaluator.is_activated()                     );
+    ASSERT_FALSE( evaluator.expression( "id 1 and" )           );
+
+    ASSERT_TRUE ( evaluator.expression( "id 1" )                                   );
+    ASSERT_TRUE ( evaluator.evaluate( data.columns( 10u ), selection )             );
+    ASSERT_FALSE( evaluator.evaluate( booleval::columnar::batch{ 10u, {} }, selection ) );
+}
+
+TEST( ColumnarEvaluatorTest, SameResultAsEvaluator )
+{
+    trades const data{ 5000u };
+
+    std::array expressions
+    {
+        "id 1",
+        "id neq 1 and price gt 95",
+        "volume geq 250000 or price leq 90.5",
+        "id lt 0 or (venue xnas and volume lt 1000)",
+        "venue gt bats and venue neq xnys",
+        "venue in (xnas, bats) and id not in (1, 2, 3)",
+        "price in (91, 92.5) or volume in (500, 700)",
+        "id gt 1.5 and volume lt 1e5",
+        "id lt 3000000000 and volume gt -1",
+        "price foo or venue 1",
+        "price 91 or price 91.5 or price 92 or id 4 or id 5",
+    };
+
+    booleval::evaluator reference
+    {
+        booleval::make_field( "id",     &trade::get_id     ),
+        booleval::make_field( "volume", &trade::get_volume ),
+        booleval::make_field( "price",  &trade::get_price  ),
+        booleval::make_field( "venue",  &trade::get_venue  )
+    };
+
+    auto evaluator{ make_evaluator() };
+
+    booleval::utils::bitmap selection;
+
+    for ( std::string_view const expression : expressions )
+    {
+        ASSERT_TRUE( reference.expression( expression ) ) << expression;
+        ASSERT_TRUE( evaluator.expression( expression ) ) << expression;
+
+        for ( auto const isa : { booleval::columnar::instruction_set::scalar, booleval::columnar::instruction_set::sse42, booleval::columnar::instruction_set::avx2 } )
+        {
+            evaluator.kernels( isa );
+
+            for ( std::size_t const size : { 0u, 63u, 64u, 4097u, 5000u } )
+            {
+                ASSERT_TRUE( evaluator.evaluate( data.columns( size ), selection ) ) << expression;
+
+                for ( std::size_t i{ 0u }; i < size; ++i )
+                {
+                    ASSERT_EQ( selection.test( i ), reference.evaluate( data.objects()[ i ] ).success ) << expression << " " << i;
+                }
+            }
+        }
+    }
+}
+
+TEST( ColumnarEvaluatorTest, Parameters )
+{
+    trades const data{ 100u };
+
+    auto evaluator{ make_evaluator() };
+
+    ASSERT_TRUE ( evaluator.expression( "id gt ? and venue in (?)" )    );
+    ASSERT_EQ   ( evaluator.evaluate( data.columns( 100u ) ).count(), 0u );
+    ASSERT_TRUE ( evaluator.parameter( 0, 5 )                           );
+    ASSERT_TRUE ( evaluator.parameter( 1, { "xnas", "xnys" } )          );
+
+    // id 6 at i % 10 == 9 and venue xnys at i % 4 == 1
+    ASSERT_EQ( evaluator.evaluate( data.columns( 100u ) ).count(), 5u );
+
+    // id 5 at i % 10 == 8 and venue xnas at i % 4 == 0
+    ASSERT_TRUE( evaluator.parameter( 0, 4 ) );
+    ASSERT_EQ  ( evaluator.evaluate( data.columns( 100u ) ).count(), 10u );
+}
+
+TEST( ColumnarEvaluatorTest, Move )
+{
+    static_assert( !std::is_copy_constructible_v< booleval::columnar::evaluator > );
+    static_assert( !std::is_copy_assignable_v   < booleval::columnar::evaluator > );
+    static_assert( !std::is_copy_constructible_v< booleval::bytecode::program   > );
+
+    trades const data{ 100u };
+
+    std::vector< booleval::columnar::evaluator > evaluators;
+
+    {
+        // expression is short enough to be stored within the object if it was kept in the string
+        auto evaluator{ make_evaluator() };
+        ASSERT_TRUE( evaluator.expression( "venue xnas" ) );
+
+        evaluators.push_back( std::move( evaluator ) );
+    }
+
+    // venue xnas at i % 4 == 0
+    ASSERT_TRUE( evaluators[ 0 ].is_activated()                                );
+    ASSERT_EQ  ( evaluators[ 0 ].evaluate( data.columns( 100u ) ).count(), 25u );
+
+    auto moved{ make_evaluator() };
+    moved = std::move( evaluators[ 0 ] );
+    evaluators.clear();
+
+    ASSERT_EQ( moved.evaluate( data.columns( 100u ) ).count(), 25u );
+}
+
+TEST( ColumnarEvaluatorTest, Kernels )
+{
+    booleval::columnar::evaluator evaluator;
+
+    ASSERT_EQ( evaluator.kernels(), booleval::columnar::supported_instruction_set() );
+
+    evaluator.kernels( booleval::columnar::instruction_set::scalar );
+    ASSERT_EQ( evaluator.kernels(), booleval::columnar::instruction_set::scalar );
+
+    evaluator.kernels( booleval::columnar::instruction_set::avx2 );
+    ASSERT_EQ( evaluator.kernels(), booleval::columnar::supported_instruction_set() );
+}
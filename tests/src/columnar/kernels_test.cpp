@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <array>
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <booleval/utils/bitmap.hpp>
+#include <booleval/token/token_type.hpp>
+#include <booleval/columnar/kernels.hpp>
+
+namespace
+{
+
+    constexpr std::array relations
+    {
+        booleval::token::token_type::eq,
+        booleval::token::token_type::neq,
+        booleval::token::token_type::gt,
+        booleval::token::token_type::lt,
+        booleval::token::token_type::geq,
+        booleval::token::token_type::leq
+    };
+
+    constexpr std::array instruction_sets
+    {
+        booleval::columnar::instruction_set::scalar,
+        booleval::columnar::instruction_set::sse42,
+        booleval::columnar::instruction_set::avx2
+    };
+
+    template< typename T >
+    bool expected( booleval::token::token_type const relation, T const value, T const constant )
+    {
+        switch ( relation )
+        {
+            case booleval::token::token_type::eq : return value == constant;
+            case booleval::token::token_type::neq: return value != constant;
+            case booleval::token::token_type::gt : return value >  constant;
+            case booleval::token::token_type::lt : return value <  constant;
+            case booleval::token::token_type::geq: return value >= constant;
+            case booleval::token::token_type::leq: return value <= constant;
+
+            default:
+                return false;
+        }
+    }
+
+    // every other word is reached by every third row only, while the rows not reaching the test keep their results
+    template< typename T >
+    void check( std::vector< T > const & values, T const constant )
+    {
+        auto const size{ std::size( values ) };
+
+        booleval::utils::bitmap active{ size };
+        for ( std::size_t i{ 0u }; i < size; ++i )
+        {
+            if ( ( i / 64u ) % 2u == 0u || i % 3u == 0u ) { active.set( i ); }
+        }
+
+        for ( auto const isa : instruction_sets )
+        {
+            if ( isa > booleval::columnar::supported_instruction_set() ) { continue; }
+
+            for ( auto const relation : relations )
+            {
+                booleval::utils::bitmap result{ size };
+                for ( std::size_t i{ 1u }; i < size; i += 2u ) { result.set( i ); }
+
+                booleval::columnar::compare( relation, isa, std::data( values ), size, constant, active.data(), result.data() );
+
+                for ( std::size_t i{ 0u }; i < size; ++i )
+                {
+                    auto const outcome{ active.test( i ) ? expected( relation, values[ i ], constant ) : i % 2u == 1u };
+                    ASSERT_EQ( result.test( i ), outcome ) << static_cast< int >( isa ) << " " << static_cast< int >( relation ) << " " << i;
+                }
+            }
+        }
+    }
+
+} // namespace
+
+TEST( KernelsTest, Int32 )
+{
+    std::vector< std::int32_t > values;
+    for ( std::int32_t i{ 0 }; i < 300; ++i )
+    {
+        values.push_back( ( i * 7 ) % 11 - 5 );
+    }
+    values.push_back( std::numeric_limits< std::int32_t >::min() );
+    values.push_back( std::numeric_limits< std::int32_t >::max() );
+
+    check< std::int32_t >( values, 0  );
+    check< std::int32_t >( values, -5 );
+    check< std::int32_t >( values, std::numeric_limits< std::int32_t >::max() );
+}
+
+TEST( KernelsTest, Int64 )
+{
+    std::vector< std::int64_t > values;
+    for ( std::int64_t i{ 0 }; i < 300; ++i )
+    {
+        values.push_back( ( i * 7 ) % 11 - 5 + ( i % 2 == 0 ? 0 : std::int64_t{ 1 } << 40 ) );
+    }
+
+    check< std::int64_t >( values, 3                             );
+    check< std::int64_t >( values, ( std::int64_t{ 1 } << 40 ) - 2 );
+}
+
+TEST( KernelsTest, Float64 )
+{
+    std::vector< double > values;
+    for ( auto i{ 0 }; i < 300; ++i )
+    {
+        values.push_back( ( i * 7 ) % 11 * 0.5 - 2.5 );
+    }
+    values[ 100 ] = std::numeric_limits< double >::quiet_NaN();
+    values[ 200 ] = std::numeric_limits< double >::infinity();
+
+    check< double >( values, 0.5  );
+    check< double >( values, -2.5 );
+}
+
+TEST( KernelsTest, SupportedInstructionSet )
+{
+    ASSERT_EQ( booleval::columnar::supported_instruction_set(), booleval::columnar::detect_instruction_set() );
+}
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include <booleval/compiled_expression.hpp>
+
+namespace
+{
+
+    template< typename T, typename U >
+    class bar
+    {
+    public:
+        bar( T && value_1, U && value_2 )
+        : value_1_{ value_1 }
+        , value_2_{ value_2 }
+        {}
+
+        T value_1() const noexcept { return value_1_; }
+        U value_2() const noexcept { return value_2_; }
+
+    private:
+        T value_1_{};
+        U value_2_{};
+    };
+
+    struct counter
+    {
+        unsigned next() noexcept { return ++count; }
+
+        unsigned count{ 0u };
+    };
+
+} // namespace
+
+TEST( CompiledExpressionTest, Evaluate )
+{
+    using object = bar< std::string, unsigned >;
+
+    auto const expression
+    {
+        booleval::compiled_expression::compile
+        (
+            "field_1 foo and field_2 gt 1",
+            {
+                booleval::make_field( "field_1", &object::value_1 ),
+                booleval::make_field( "field_2", &object::value_2 )
+            }
+        )
+    };
+
+    ASSERT_TRUE ( expression->is_activated()                          );
+    ASSERT_TRUE ( expression->evaluate( object{ "foo", 2 } ).success );
+    ASSERT_FALSE( expression->evaluate( object{ "foo", 1 } ).success );
+    ASSERT_FALSE( expression->evaluate( object{ "bar", 2 } ).success );
+}
+
+TEST( CompiledExpressionTest, InvalidExpression )
+{
+    using object = bar< std::string, unsigned >;
+
+    auto const invalid{ booleval::compiled_expression::compile( "field_1 foo and", {} ) };
+
+    ASSERT_FALSE( invalid->is_activated()                                               );
+    ASSERT_EQ   ( invalid->evaluate( object{ "foo", 2 } ).message, "Evaluator not activated" );
+
+    auto const unknown
+    {
+        booleval::compiled_expression::compile
+        (
+            "field_1 foo or unknown 1",
+            {
+                booleval::make_field( "field_1", &object::value_1 )
+            }
+        )
+    };
+
+    ASSERT_FALSE( unknown->is_activated()                                     );
+    ASSERT_EQ   ( unknown->evaluate( object{ "foo", 2 } ).message, "Unknown field" );
+}
+
+TEST( CompiledExpressionTest, Typed )
+{
+    using object = bar< std::string, unsigned >;
+
+    auto const expression
+    {
+        booleval::typed_compiled_expression< object >::compile
+        (
+            "field_1 in (foo, baz) or field_2 3",
+            {
+                { "field_1", &object::value_1 },
+                { "field_2", &object::value_2 }
+            }
+        )
+    };
+
+    ASSERT_TRUE ( expression->evaluate( object{ "baz", 1 } ).success );
+    ASSERT_TRUE ( expression->evaluate( object{ "bar", 3 } ).success );
+    ASSERT_FALSE( expression->evaluate( object{ "bar", 2 } ).success );
+}
+
+TEST( CompiledExpressionTest, EvaluateBatch )
+{
+    using object = bar< std::string, unsigned >;
+
+    auto const expression
+    {
+        booleval::typed_compiled_expression< object >::compile
+        (
+            "field_1 not in (foo) and field_2 gt 97",
+            {
+                { "field_1", &object::value_1 },
+                { "field_2", &object::value_2 }
+            }
+        )
+    };
+
+    std::vector< object > objects;
+    for ( unsigned i{ 0u }; i < 100u; ++i )
+    {
+        objects.emplace_back( i % 2 == 0 ? "foo" : "bar", std::move( i ) );
+    }
+
+    auto const selection{ expression->evaluate_batch( objects ) };
+
+    ASSERT_EQ  ( selection.count(), 1u );
+    ASSERT_TRUE( selection.test( 99u ) );
+}
+
+TEST( CompiledExpressionTest, ConcurrentEvaluation )
+{
+    using object = bar< std::string, unsigned >;
+
+    auto const expression
+    {
+        booleval::compiled_expression::compile
+        (
+            "(field_1 foo and field_2 lt 500) or (field_1 bar and field_2 geq 500)",
+            {
+                booleval::make_field( "field_1", &object::value_1 ),
+                booleval::make_field( "field_2", &object::value_2 )
+            }
+        )
+    };
+
+    std::vector< object > objects;
+    for ( unsigned i{ 0u }; i < 1000u; ++i )
+    {
+        objects.emplace_back( i % 2 == 0 ? "foo" : "bar", std::move( i ) );
+    }
+
+    std::atomic< unsigned > matches{ 0u };
+    std::vector< std::thread > threads;
+
+    for ( auto t{ 0 }; t < 4; ++t )
+    {
+        threads.emplace_back
+        (
+            [ expression, &objects, &matches ]
+            {
+                for ( auto const & obj : objects )
+                {
+                    if ( expression->evaluate( obj ).success ) { ++matches; }
+                }
+            }
+        );
+    }
+
+    for ( auto & thread : threads ) { thread.join(); }
+
+    // 250 even values below 500 and 250 odd values from 500 on, found by each thread
+    ASSERT_EQ( matches.load(), 4u * 500u );
+}
+
+TEST( CompiledExpressionTest, ConstObjects )
+{
+    booleval::field< counter > const next { "next",  &counter::next  };
+    booleval::field< counter > const count{ "count", &counter::count };
+
+    counter         x;
+    counter const & y{ x };
+
+    // non-const getters are never called on const objects
+    ASSERT_EQ( next.invoke( y ).type(), booleval::utils::any_value::kind::none );
+    ASSERT_EQ( x.count, 0u                                                     );
+
+    ASSERT_EQ( next .invoke( x ), "1" );
+    ASSERT_EQ( count.invoke( y ), "1" );
+}
@@ -27,6 +27,8 @@
  *
  */
 
+#include <string>
+#include <vector>
 #include <gtest/gtest.h>
 #include <booleval/evaluator.hpp>
 
@@ -424,6 +426,93 @@ TEST( EvaluatorTest, OrOperator )
     }
 }
 
+TEST( EvaluatorTest, InOperator )
+{
+    bar< std::string, unsigned > x{ "foo", 1 };
+    bar< std::string, unsigned > y{ "bar", 2 };
+    bar< std::string, unsigned > z{ "baz", 3 };
+
+    booleval::evaluator evaluator
+    {
+        {
+            booleval::make_field( "field_1", &bar< std::string, unsigned >::value_1 ),
+            booleval::make_field( "field_2", &bar< std::string, unsigned >::value_2 )
+        }
+    };
+
+    {
+        ASSERT_TRUE ( evaluator.expression( "field_1 in (foo, bar)" ) );
+        ASSERT_TRUE ( evaluator.evaluate( x ).success                 );
+        ASSERT_TRUE ( evaluator.evaluate( y ).success                 );
+        ASSERT_FALSE( evaluator.evaluate( z ).success                 );
+    }
+    {
+        ASSERT_TRUE ( evaluator.expression( "field_2 IN (3, 1) and field_1 in (\"baz\")" ) );
+        ASSERT_FALSE( evaluator.evaluate( x ).success                                       );
+        ASSERT_FALSE( evaluator.evaluate( y ).success                                       );
+        ASSERT_TRUE ( evaluator.evaluate( z ).success                                       );
+    }
+    {
+        ASSERT_FALSE( evaluator.expression( "field_1 in foo, bar" ) );
+        ASSERT_FALSE( evaluator.expression( "field_1 in ()"       ) );
+    }
+}
+
+TEST( EvaluatorTest, CommaOutsideOfSet )
+{
+    bar< std::string, unsigned > x{ "foo",     1 };
+    bar< std::string, unsigned > y{ "foo,bar", 1 };
+
+    booleval::evaluator evaluator
+    {
+        {
+            booleval::make_field( "field_1", &bar< std::string, unsigned >::value_1 ),
+            booleval::make_field( "field_2", &bar< std::string, unsigned >::value_2 )
+        }
+    };
+
+    // unquoted comma outside of the set is a part of the value
+    ASSERT_TRUE ( evaluator.expression( "field_1 foo,bar" ) );
+    ASSERT_FALSE( evaluator.evaluate( x ).success           );
+    ASSERT_TRUE ( evaluator.evaluate( y ).success           );
+
+    ASSERT_TRUE ( evaluator.expression( "field_2 1 and field_1 in (foo,bar)" ) );
+    ASSERT_TRUE ( evaluator.evaluate( x ).success                              );
+    ASSERT_FALSE( evaluator.evaluate( y ).success                              );
+
+    ASSERT_TRUE ( evaluator.expression( "field_1 in (foo,bar) and field_1 foo,bar" ) );
+    ASSERT_FALSE( evaluator.evaluate( x ).success                                    );
+    ASSERT_FALSE( evaluator.evaluate( y ).success                                    );
+}
+
+TEST( EvaluatorTest, NotInOperator )
+{
+    bar< std::string, unsigned > x{ "foo", 1 };
+    bar< std::string, unsigned > y{ "bar", 2 };
+    bar< std::string, unsigned > z{ "baz", 3 };
+
+    booleval::evaluator evaluator
+    {
+        {
+            booleval::make_field( "field_1", &bar< std::string, unsigned >::value_1 ),
+            booleval::make_field( "field_2", &bar< std::string, unsigned >::value_2 )
+        }
+    };
+
+    {
+        ASSERT_TRUE ( evaluator.expression( "field_1 not in (foo, bar)" ) );
+        ASSERT_FALSE( evaluator.evaluate( x ).success                     );
+        ASSERT_FALSE( evaluator.evaluate( y ).success                     );
+        ASSERT_TRUE ( evaluator.evaluate( z ).success                     );
+    }
+    {
+        ASSERT_TRUE ( evaluator.expression( "field_2 NOT IN (1) or field_1 foo" ) );
+        ASSERT_TRUE ( evaluator.evaluate( x ).success                           );
+        ASSERT_TRUE ( evaluator.evaluate( y ).success                           );
+        ASSERT_TRUE ( evaluator.evaluate( z ).success                           );
+    }
+}
+
 TEST( EvaluatorTest, MultipleOperators )
 {
     bar< std::string, unsigned > x{ "foo", 1 };
@@ -473,6 +562,39 @@ TEST( EvaluatorTest, MultipleOperators )
     }
 }
 
+TEST( EvaluatorTest, DeepNesting )
+{
+    constexpr std::size_t depth{ 200000u };
+
+    bar< std::string, unsigned > x{ "foo", 1 };
+    bar< std::string, unsigned > y{ "bar", 1 };
+
+    booleval::evaluator evaluator
+    {
+        {
+            booleval::make_field( "field_1", &bar< std::string, unsigned >::value_1 ),
+            booleval::make_field( "field_2", &bar< std::string, unsigned >::value_2 )
+        }
+    };
+
+    // each 'and' is followed by the passing test and each 'or' by the failing one,
+    // so only the innermost test decides the result
+    std::string expression;
+
+    for ( std::size_t i{ 0u }; i < depth; ++i )
+    {
+        expression += i % 2u == 0u ? "(field_2 1 and " : "(field_2 2 or ";
+    }
+
+    expression += "field_1 foo";
+    expression += std::string( depth, ')' );
+
+    ASSERT_TRUE ( evaluator.expression( expression ) );
+    ASSERT_TRUE ( evaluator.is_activated()           );
+    ASSERT_TRUE ( evaluator.evaluate( x ).success    );
+    ASSERT_FALSE( evaluator.evaluate( y ).success    );
+}
+
 TEST( EvaluatorTest, DifferentClasses )
 {
     foo< unsigned              > x{ 1        };
@@ -494,6 +616,30 @@ TEST( EvaluatorTest, DifferentClasses )
     }
 }
 
+TEST( EvaluatorTest, DataMember )
+{
+    struct qux
+    {
+        unsigned    value_1;
+        std::string value_2;
+    };
+
+    booleval::evaluator evaluator
+    {
+        {
+            booleval::make_field( "field_1", &qux::value_1 ),
+            booleval::make_field( "field_2", &qux::value_2 )
+        }
+    };
+
+    qux x{ 1, "foo" };
+    qux y{ 2, "bar" };
+
+    ASSERT_TRUE ( evaluator.expression( "field_1 1 and field_2 foo" ) );
+    ASSERT_TRUE ( evaluator.evaluate( x ).success                     );
+    ASSERT_FALSE( evaluator.evaluate( y ).success                     );
+}
+
 TEST( EvaluatorTest, UnknownField )
 {
     foo< unsigned > x{ 1 };
@@ -504,13 +650,163 @@ TEST( EvaluatorTest, UnknownField )
     };
 
     {
-        ASSERT_TRUE ( evaluator.expression( "unknown_field 1" )        );
-        ASSERT_TRUE ( evaluator.is_activated()                         );
+        ASSERT_FALSE( evaluator.expression( "unknown_field 1" )        );
+        ASSERT_FALSE( evaluator.is_activated()                         );
 
         auto const result{ evaluator.evaluate( x ) };
         ASSERT_FALSE( result.success                  );
         ASSERT_EQ   ( result.message, "Unknown field" );
     }
+    {
+        ASSERT_FALSE( evaluator.expression( "field 1 or unknown_field 1" ) );
+        ASSERT_FALSE( evaluator.is_activated()                             );
+    }
+}
+
+TEST( EvaluatorTest, FieldsChangedAfterExpression )
+{
+    foo< unsigned > x{ 1 };
+
+    booleval::evaluator evaluator;
+
+    ASSERT_FALSE( evaluator.expression( "field 1" ) );
+    ASSERT_FALSE( evaluator.is_activated()          );
+
+    evaluator.fields
+    ({
+        booleval::make_field( "field", &foo< unsigned >::value )
+    });
+
+    ASSERT_TRUE( evaluator.is_activated()          );
+    ASSERT_TRUE( evaluator.evaluate( x ).success   );
+
+    evaluator.fields
+    ({
+        booleval::make_field( "other", &foo< unsigned >::value )
+    });
+
+    ASSERT_FALSE( evaluator.is_activated()                          );
+    ASSERT_EQ   ( evaluator.evaluate( x ).message, "Unknown field" );
+}
+
+TEST( EvaluatorTest, CachedExpressions )
+{
+    foo< unsigned > x{ 1 };
+
+    booleval::evaluator evaluator
+    {
+        booleval::make_field( "field", &foo< unsigned >::value )
+    };
+    evaluator.cache_capacity( 2 );
+
+    ASSERT_TRUE( evaluator.expression( "field 1" ) );
+    ASSERT_TRUE( evaluator.expression( "field 2" ) );
+    ASSERT_TRUE( evaluator.expression( "field 1" ) );
+
+    ASSERT_EQ  ( evaluator.cache().hits(),   1u );
+    ASSERT_EQ  ( evaluator.cache().misses(), 2u );
+    ASSERT_TRUE( evaluator.evaluate( x ).success );
+
+    // 'field 2' is the least recently used expression, so it is evicted
+    ASSERT_TRUE ( evaluator.expression( "field 3" )       );
+    ASSERT_FALSE( evaluator.evaluate( x ).success         );
+    ASSERT_TRUE ( evaluator.expression( "field 1" )       );
+    ASSERT_TRUE ( evaluator.expression( "field 2" )       );
+    ASSERT_EQ   ( evaluator.cache().hits(),   2u          );
+    ASSERT_EQ   ( evaluator.cache().misses(), 4u          );
+
+    // invalid expressions are not cached
+    ASSERT_FALSE( evaluator.expression( "field 1 or" ) );
+    ASSERT_FALSE( evaluator.expression( "field 1 or" ) );
+    ASSERT_EQ   ( evaluator.cache().misses(), 6u       );
+
+    // cached expressions are bound again after the fields are changed
+    evaluator.fields
+    ({
+        booleval::make_field( "other", &foo< unsigned >::value )
+    });
+
+    ASSERT_FALSE( evaluator.expression( "field 1" )                 );
+    ASSERT_EQ   ( evaluator.evaluate( x ).message, "Unknown field" );
+
+    evaluator.fields
+    ({
+        booleval::make_field( "field", &foo< unsigned >::value )
+    });
+
+    ASSERT_TRUE( evaluator.expression( "field 1" ) );
+    ASSERT_TRUE( evaluator.evaluate( x ).success   );
+}
+
+TEST( EvaluatorTest, Parameters )
+{
+    using object = bar< std::string, double >;
+
+    object x{ "foo", 1.5 };
+    object y{ "bar", 2.5 };
+
+    booleval::evaluator evaluator
+    {
+        booleval::make_field( "field_1", &object::value_1 ),
+        booleval::make_field( "field_2", &object::value_2 )
+    };
+
+    ASSERT_TRUE( evaluator.expression( "field_2 gt ? and field_1 in (?)" ) );
+    ASSERT_TRUE( evaluator.is_activated()                                   );
+
+    ASSERT_EQ( evaluator.evaluate( x ).message, "Unbound parameter" );
+
+    ASSERT_FALSE( evaluator.parameter( 2, 1 )                       );
+    ASSERT_TRUE ( evaluator.parameter( 0, 1 )                       );
+    ASSERT_TRUE ( evaluator.parameter( 1, { "foo", "bar" } )       );
+    ASSERT_TRUE ( evaluator.evaluate( x ).success                  );
+    ASSERT_TRUE ( evaluator.evaluate( y ).success                  );
+
+    // values are bound again without building the expression again
+    std::string const value{ "bar" };
+    ASSERT_TRUE ( evaluator.parameter( 0, 2.0F )                               );
+    ASSERT_TRUE ( evaluator.parameter( 1, &value, &value + 1 )                 );
+    ASSERT_FALSE( evaluator.evaluate( x ).success                              );
+    ASSERT_TRUE ( evaluator.evaluate( y ).success                              );
+
+    ASSERT_TRUE ( evaluator.parameter( 0, std::string{ "2.5" } ) );
+    ASSERT_FALSE( evaluator.evaluate( y ).success                );
+}
+
+TEST( EvaluatorTest, EvaluateBatch )
+{
+    using object = bar< std::string, unsigned >;
+
+    std::vector< object > objects;
+    for ( unsigned i{ 0u }; i < 100u; ++i )
+    {
+        objects.emplace_back( i % 2 == 0 ? "foo" : "bar", std::move( i ) );
+    }
+
+    booleval::evaluator evaluator
+    {
+        booleval::make_field( "field_1", &object::value_1 ),
+        booleval::make_field( "field_2", &object::value_2 )
+    };
+
+    booleval::utils::bitmap selection;
+    ASSERT_FALSE( evaluator.evaluate_batch( objects, selection ) );
+    ASSERT_EQ   ( selection.size(), 100u                        );
+    ASSERT_EQ   ( selection.count(), 0u                         );
+
+    ASSERT_TRUE( evaluator.expression( "field_1 foo and field_2 lt 10 or field_2 geq 95" ) );
+
+    std::vector< std::size_t > indices;
+    evaluator.evaluate_batch( objects ).indices( indices );
+
+    ASSERT_EQ( indices, ( std::vector< std::size_t >{ 0u, 2u, 4u, 6u, 8u, 95u, 96u, 97u, 98u, 99u } ) );
+
+    ASSERT_TRUE ( evaluator.expression( "field_2 in (?)" )             );
+    ASSERT_FALSE( evaluator.evaluate_batch( objects, selection )       );
+    ASSERT_TRUE ( evaluator.parameter( 0, { 1, 64, 99 } )              );
+    ASSERT_TRUE ( evaluator.evaluate_batch( objects, selection )       );
+    ASSERT_EQ   ( selection.count(), 3u                                );
+    ASSERT_TRUE ( selection.test( 64u )                                );
 }
 
 TEST( EvaluatorTest, EmptyStringInMiddleOfExpression )
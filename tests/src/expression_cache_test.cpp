@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <gtest/gtest.h>
+#include <booleval/expression_cache.hpp>
+
+TEST( ExpressionCacheTest, DefaultConstructor )
+{
+    booleval::expression_cache cache;
+
+    ASSERT_TRUE( cache.empty()         );
+    ASSERT_EQ  ( cache.capacity(), 0u  );
+    ASSERT_EQ  ( cache.hits(),     0u  );
+    ASSERT_EQ  ( cache.misses(),   0u  );
+}
+
+TEST( ExpressionCacheTest, FindAndInsert )
+{
+    booleval::expression_cache cache{ 2 };
+
+    ASSERT_EQ( cache.find( "field_a foo" ), nullptr );
+
+    auto & entry{ cache.insert( "field_a foo" ) };
+    ASSERT_EQ( entry.text, "field_a foo" );
+
+    ASSERT_EQ( cache.find( "field_a foo" ), &entry );
+    ASSERT_EQ( cache.size(),   1u );
+    ASSERT_EQ( cache.hits(),   1u );
+    ASSERT_EQ( cache.misses(), 1u );
+}
+
+TEST( ExpressionCacheTest, LeastRecentlyUsedEviction )
+{
+    booleval::expression_cache cache{ 2 };
+
+    cache.insert( "field_a foo" );
+    auto * const second{ &cache.insert( "field_b bar" ) };
+
+    ASSERT_NE( cache.find( "field_a foo" ), nullptr );
+
+    // storage of the evicted entry is reused
+    ASSERT_EQ( &cache.insert( "field_c baz" ), second );
+    ASSERT_EQ( second->text, "field_c baz"            );
+
+    ASSERT_EQ( cache.find( "field_b bar" ), nullptr );
+    ASSERT_NE( cache.find( "field_a foo" ), nullptr );
+    ASSERT_EQ( cache.find( "field_c baz" ), second  );
+    ASSERT_EQ( cache.size(), 2u                     );
+}
+
+TEST( ExpressionCacheTest, Capacity )
+{
+    booleval::expression_cache cache{ 3 };
+
+    cache.insert( "field_a foo" );
+    cache.insert( "field_b bar" );
+    cache.insert( "field_c baz" );
+
+    cache.capacity( 1 );
+
+    ASSERT_EQ( cache.size(), 1u                     );
+    ASSERT_EQ( cache.find( "field_b bar" ), nullptr );
+    ASSERT_NE( cache.find( "field_c baz" ), nullptr );
+}
+
+TEST( ExpressionCacheTest, Disabled )
+{
+    booleval::expression_cache cache;
+
+    auto & entry{ cache.insert( "field_a foo" ) };
+
+    // the last inserted entry is stored, but it is never found
+    ASSERT_EQ( cache.size(), 1u                     );
+    ASSERT_EQ( cache.find( "field_a foo" ), nullptr );
+    ASSERT_EQ( &cache.insert( "field_b bar" ), &entry );
+    ASSERT_EQ( cache.size(),   1u                   );
+    ASSERT_EQ( cache.misses(), 0u                   );
+}
+
+TEST( ExpressionCacheTest, EraseAndClear )
+{
+    booleval::expression_cache cache{ 2 };
+
+    cache.insert( "field_a foo" );
+    cache.insert( "field_b bar" );
+
+    cache.erase( "field_a foo" );
+    cache.erase( "field_x qux" );
+
+    ASSERT_EQ( cache.size(), 1u                     );
+    ASSERT_EQ( cache.find( "field_a foo" ), nullptr );
+
+    cache.clear();
+
+    ASSERT_TRUE( cache.empty()         );
+    ASSERT_EQ  ( cache.misses(), 1u    );
+}
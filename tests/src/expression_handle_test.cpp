@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include <booleval/expression_handle.hpp>
+
+namespace
+{
+
+    template< typename T, typename U >
+    class bar
+    {
+    public:
+        bar( T && value_1, U && value_2 )
+        : value_1_{ value_1 }
+        , value_2_{ value_2 }
+        {}
+
+        T value_1() const noexcept { return value_1_; }
+        U value_2() const noexcept { return value_2_; }
+
+    private:
+        T value_1_{};
+        U value_2_{};
+    };
+
+    using object = bar< std::string, unsigned >;
+
+    auto compile( std::string_view const expression )
+    {
+        return booleval::compiled_expression::compile
+        (
+            expression,
+            {
+                booleval::make_field( "field_1", &object::value_1 ),
+                booleval::make_field( "field_2", &object::value_2 )
+            }
+        );
+    }
+
+} // namespace
+
+TEST( ExpressionHandleTest, NotPublished )
+{
+    booleval::expression_handle handle;
+
+    auto const reader{ handle.make_reader() };
+
+    ASSERT_FALSE( reader.lock()                                                 );
+    ASSERT_EQ   ( reader.evaluate( object{ "foo", 1 } ).message, "Evaluator not activated" );
+    ASSERT_EQ   ( handle.load(), nullptr                                        );
+}
+
+TEST( ExpressionHandleTest, Publish )
+{
+    booleval::expression_handle handle{ compile( "field_1 foo" ) };
+
+    auto const reader{ handle.make_reader() };
+
+    ASSERT_TRUE ( reader.evaluate( object{ "foo", 1 } ).success );
+    ASSERT_FALSE( reader.evaluate( object{ "bar", 1 } ).success );
+
+    handle.publish( compile( "field_1 bar" ) );
+
+    ASSERT_FALSE( reader.evaluate( object{ "foo", 1 } ).success );
+    ASSERT_TRUE ( reader.evaluate( object{ "bar", 1 } ).success );
+    ASSERT_EQ   ( handle.reclaim(), 0u                          );
+}
+
+TEST( ExpressionHandleTest, Reclaim )
+{
+    booleval::expression_handle handle{ compile( "field_1 foo" ) };
+
+    std::weak_ptr< booleval::compiled_expression const > const first{ handle.load() };
+
+    auto const reader{ handle.make_reader() };
+
+    {
+        auto const expression{ reader.lock() };
+
+        handle.publish( compile( "field_1 bar" ) );
+
+        // evaluation started before publishing keeps the previous expression
+        ASSERT_FALSE( first.expired()                                  );
+        ASSERT_EQ   ( handle.reclaim(), 1u                             );
+        ASSERT_TRUE ( expression->evaluate( object{ "foo", 1 } ).success );
+    }
+
+    ASSERT_EQ  ( handle.reclaim(), 0u );
+    ASSERT_TRUE( first.expired()      );
+}
+
+TEST( ExpressionHandleTest, ReaderReuse )
+{
+    booleval::expression_handle handle{ compile( "field_1 foo" ) };
+
+    std::weak_ptr< booleval::compiled_expression const > const first{ handle.load() };
+
+    {
+        auto const reader{ handle.make_reader() };
+        auto const expression{ reader.lock() };
+
+        handle.publish( compile( "field_1 bar" ) );
+    }
+
+    // slot of the destroyed reader is idle and gets reused
+    auto const reader{ handle.make_reader() };
+
+    ASSERT_EQ  ( handle.reclaim(), 0u                          );
+    ASSERT_TRUE( first.expired()                               );
+    ASSERT_TRUE( reader.evaluate( object{ "bar", 1 } ).success );
+}
+
+TEST( ExpressionHandleTest, ConcurrentPublish )
+{
+    booleval::expression_handle handle{ compile( "field_2 lt 500" ) };
+
+    std::vector< object > objects;
+    for ( unsigned i{ 0u }; i < 1000u; ++i )
+    {
+        objects.emplace_back( "foo", std::move( i ) );
+    }
+
+    std::atomic< bool > done{ false };
+    std::atomic< bool > failed{ false };
+    std::vector< std::thread > threads;
+
+    for ( auto t{ 0 }; t < 4; ++t )
+    {
+        threads.emplace_back
+        (
+            [ &handle, &objects, &done, &failed ]
+            {
+                auto const reader{ handle.make_reader() };
+
+                while ( !done.load() )
+                {
+                    // one pass over the objects sees exactly one of the published expressions
+                    auto const expression{ reader.lock() };
+
+                    unsigned matches{ 0u };
+                    for ( auto const & obj : objects )
+                    {
+                        if ( expression->evaluate( obj ).success ) { ++matches; }
+                    }
+
+                    if ( matches != 500u ) { failed = true; }
+                }
+            }
+        );
+    }
+
+    for ( auto i{ 0 }; i < 200; ++i )
+    {
+        handle.publish( compile( i % 2 == 0 ? "field_2 geq 500" : "field_2 lt 500" ) );
+    }
+
+    done = true;
+    for ( auto & thread : threads ) { thread.join(); }
+
+    ASSERT_FALSE( failed.load()       );
+    ASSERT_EQ   ( handle.reclaim(), 0u );
+}
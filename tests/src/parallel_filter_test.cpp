@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <booleval/parallel_filter.hpp>
+#include <booleval/compiled_expression.hpp>
+
+namespace
+{
+
+    struct trade
+    {
+        unsigned    id;
+        std::string venue;
+
+        unsigned    get_id   () const noexcept { return id;    }
+        std::string get_venue() const noexcept { return venue; }
+    };
+
+    std::vector< trade > make_trades( unsigned const size )
+    {
+        std::vector< trade > trades;
+        for ( unsigned i{ 0u }; i < size; ++i )
+        {
+            trades.push_back( { i, i % 3u == 0u ? "xnas" : "xnys" } );
+        }
+        return trades;
+    }
+
+} // namespace
+
+TEST( ParallelFilterTest, Filter )
+{
+    auto const trades{ make_trades( 100000u ) };
+
+    auto const expression
+    {
+        booleval::typed_compiled_expression< trade >::compile
+        (
+            "venue xnas and id lt 50000",
+            {
+                { "id",    &trade::get_id    },
+                { "venue", &trade::get_venue }
+            }
+        )
+    };
+
+    std::vector< std::size_t > expected;
+    for ( std::size_t i{ 0u }; i < 50000u; i += 3u ) { expected.push_back( i ); }
+
+    booleval::thread_pool pool{ 4u };
+
+    // chunks that do not end at the word boundary
+    ASSERT_EQ( booleval::parallel_filter( trades, *expression, pool, 1000u ), expected );
+    ASSERT_EQ( booleval::parallel_filter( trades, *expression, pool        ), expected );
+    ASSERT_EQ( booleval::parallel_filter( trades, *expression, 3u          ), expected );
+
+    ASSERT_EQ( booleval::parallel_count( trades, *expression, pool, 1000u ), std::size( expected ) );
+    ASSERT_EQ( booleval::parallel_count( trades, *expression, pool        ), std::size( expected ) );
+}
+
+TEST( ParallelFilterTest, Empty )
+{
+    std::vector< trade > const trades;
+
+    auto const expression
+    {
+        booleval::typed_compiled_expression< trade >::compile( "id 1", { { "id", &trade::get_id } } )
+    };
+
+    booleval::thread_pool pool{ 2u };
+
+    ASSERT_TRUE( booleval::parallel_filter( trades, *expression, pool ).empty() );
+    ASSERT_EQ  ( booleval::parallel_count ( trades, *expression, pool ), 0u     );
+}
+
+TEST( ParallelFilterTest, NotActivated )
+{
+    auto const trades{ make_trades( 1000u ) };
+
+    auto const expression
+    {
+        booleval::typed_compiled_expression< trade >::compile( "unknown 1", { { "id", &trade::get_id } } )
+    };
+
+    booleval::thread_pool pool{ 2u };
+
+    ASSERT_TRUE( booleval::parallel_filter( trades, *expression, pool, 100u ).empty() );
+}
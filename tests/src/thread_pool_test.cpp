@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include <booleval/thread_pool.hpp>
+
+TEST( ThreadPoolTest, Size )
+{
+    booleval::thread_pool single{ 0u };
+    booleval::thread_pool pool  { 3u };
+
+    ASSERT_EQ( single.size(), 1u );
+    ASSERT_EQ( pool  .size(), 3u );
+}
+
+TEST( ThreadPoolTest, EachTaskRunOnce )
+{
+    booleval::thread_pool pool{ 4u };
+
+    for ( std::size_t const tasks : { 0u, 1u, 3u, 1000u } )
+    {
+        std::vector< std::atomic< unsigned > > runs( tasks );
+
+        pool.for_each( tasks, [ &runs ]( std::size_t const task ) { ++runs[ task ]; } );
+
+        for ( auto const & run : runs )
+        {
+            ASSERT_EQ( run.load(), 1u );
+        }
+    }
+}
+
+TEST( ThreadPoolTest, Stealing )
+{
+    booleval::thread_pool pool{ 2u };
+
+    std::atomic< bool     > blocked{ false };
+    std::atomic< unsigned > done   { 0u    };
+
+    std::thread::id                stuck;
+    std::vector< std::thread::id > owners( 100u );
+
+    // the first worker gets stuck on its first task, so the other one runs all the other
+    // tasks, half of which are stolen from the queue of the stuck worker
+    pool.for_each
+    (
+        100u,
+        [ & ]( std::size_t const task )
+        {
+            if ( !blocked.exchange( true ) )
+            {
+                stuck = std::this_thread::get_id();
+                while ( done.load() < 99u ) { std::this_thread::sleep_for( std::chrono::milliseconds{ 1 } ); }
+                return;
+            }
+
+            owners[ task ] = std::this_thread::get_id();
+            ++done;
+        }
+    );
+
+    ASSERT_EQ( done.load(), 99u );
+
+    auto const other{ owners[ 0 ] == std::thread::id{} ? owners[ 1 ] : owners[ 0 ] };
+
+    ASSERT_NE( other, stuck );
+
+    for ( auto const & owner : owners )
+    {
+        ASSERT_TRUE( owner == other || owner == std::thread::id{} );
+    }
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <string_view>
+#include <gtest/gtest.h>
+
+#include <booleval/tree/tree.hpp>
+#include <booleval/token/lexer.hpp>
+#include <booleval/token/token_type.hpp>
+
+TEST( LexerTest, EmptyExpression )
+{
+    booleval::token::lexer empty{ "" };
+    ASSERT_TRUE( empty.empty() );
+
+    booleval::token::lexer whitespace{ "   " };
+    ASSERT_TRUE( whitespace.empty() );
+}
+
+TEST( LexerTest, PeekDoesNotConsume )
+{
+    booleval::token::lexer lexer{ "field_a foo and field_b not in (1)" };
+
+    ASSERT_FALSE( lexer.empty() );
+    ASSERT_TRUE ( lexer.peek().is( booleval::token::token_type::field ) );
+    ASSERT_TRUE ( lexer.peek().is( booleval::token::token_type::field ) );
+    ASSERT_EQ   ( lexer.next().value(), "field_a" );
+
+    // implicit equal to operator between two field tokens
+    ASSERT_TRUE( lexer.peek().is( booleval::token::token_type::eq ) );
+    ASSERT_TRUE( lexer.next().is( booleval::token::token_type::eq ) );
+    ASSERT_EQ  ( lexer.next().value(), "foo" );
+
+    ASSERT_TRUE( lexer.next().is( booleval::token::token_type::logical_and ) );
+    ASSERT_TRUE( lexer.next().is( booleval::token::token_type::field       ) );
+    ASSERT_TRUE( lexer.next().is( booleval::token::token_type::not_in      ) );
+    ASSERT_TRUE( lexer.next().is( booleval::token::token_type::lp          ) );
+    ASSERT_TRUE( lexer.next().is( booleval::token::token_type::field       ) );
+    ASSERT_TRUE( lexer.next().is( booleval::token::token_type::rp          ) );
+    ASSERT_TRUE( lexer.empty() );
+}
+
+TEST( LexerTest, TrailingNegation )
+{
+    booleval::token::lexer lexer{ "field_a not" };
+
+    ASSERT_EQ  ( lexer.next().value(), "field_a" );
+    ASSERT_TRUE( lexer.next().is( booleval::token::token_type::eq ) );
+
+    auto const negation{ lexer.next() };
+    ASSERT_TRUE( negation.is( booleval::token::token_type::field ) );
+    ASSERT_EQ  ( negation.value(), "not" );
+    ASSERT_TRUE( lexer.empty() );
+}
+
+TEST( LexerTest, ParsingStopsAtFirstError )
+{
+    booleval::tree::arena  arena;
+    booleval::token::lexer lexer{ arena.text( "field_a eq 1 and eq field_b eq 2 or field_c eq 3" ) };
+
+    ASSERT_EQ( booleval::tree::internal::parse( lexer, arena ), booleval::tree::null_node );
+
+    // the rest of the expression is never split
+    ASSERT_FALSE( lexer.empty() );
+    ASSERT_EQ   ( lexer.next().value(), "field_b" );
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <string>
+#include <string_view>
+#include <gtest/gtest.h>
+
+#include <booleval/token/token_type.hpp>
+#include <booleval/token/token_type_utils.hpp>
+
+static_assert( booleval::token::to_token_type( "and" ) == booleval::token::token_type::logical_and );
+static_assert( booleval::token::to_token_type( ">="  ) == booleval::token::token_type::geq         );
+static_assert( booleval::token::to_token_type( "ANY" ) == booleval::token::token_type::field       );
+static_assert( booleval::token::to_token_type( ""    ) == booleval::token::token_type::field       );
+
+TEST( TokenTypeUtilsTest, KeywordsAndSymbols )
+{
+    for ( auto const & [ value, type ] : booleval::token::internal::keywords )
+    {
+        ASSERT_EQ( booleval::token::to_token_type( value ), type ) << value;
+    }
+
+    for ( auto const & [ value, type ] : booleval::token::internal::symbols )
+    {
+        ASSERT_EQ( booleval::token::to_token_type( value ), type ) << value;
+    }
+}
+
+TEST( TokenTypeUtilsTest, Fields )
+{
+    for
+    (
+        auto const value :
+        {
+            "a", "an", "andd", "aNd", "And", "nd", "ad", "eqq", "NE", "not", "NOT", "not  in", "in ",
+            "=", "!", "&", "|", "=>", "=<", "<>", "((", "()", ",,", "??", "field_a", "1", "-1.5"
+        }
+    )
+    {
+        ASSERT_EQ( booleval::token::to_token_type( value ), booleval::token::token_type::field ) << value;
+    }
+
+    // lexemes sharing the length, the first and the last character with the keywords and symbols
+    for ( auto const & [ value, type ] : booleval::token::internal::lexemes )
+    {
+        if ( std::size( value ) < 3u ) { continue; }
+
+        std::string other{ value };
+        other[ 1 ] = '_';
+
+        ASSERT_EQ( booleval::token::to_token_type( other ), booleval::token::token_type::field ) << other;
+    }
+}
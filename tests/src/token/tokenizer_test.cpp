@@ -134,3 +134,78 @@ TEST( TokenizerTest, SymbolExpression )
     ASSERT_TRUE( tokens[ 12 ].is( booleval::token::token_type::field ) );
     ASSERT_EQ  ( tokens[ 12 ].value(), "baz" );
 }
+
+TEST( TokenizerTest, InExpression )
+{
+    auto const tokens{ booleval::token::tokenize( "field_a in (foo,bar) and field_b NOT IN ( \"not\" , 1 ) or not baz" ) };
+    ASSERT_EQ( std::size( tokens ), 19u );
+
+    ASSERT_TRUE( tokens[ 0 ].is( booleval::token::token_type::field ) );
+    ASSERT_TRUE( tokens[ 1 ].is( booleval::token::token_type::in    ) );
+    ASSERT_TRUE( tokens[ 2 ].is( booleval::token::token_type::lp    ) );
+    ASSERT_TRUE( tokens[ 3 ].is( booleval::token::token_type::field ) );
+    ASSERT_TRUE( tokens[ 4 ].is( booleval::token::token_type::comma ) );
+    ASSERT_TRUE( tokens[ 5 ].is( booleval::token::token_type::field ) );
+    ASSERT_TRUE( tokens[ 6 ].is( booleval::token::token_type::rp    ) );
+
+    ASSERT_TRUE( tokens[  7 ].is( booleval::token::token_type::logical_and ) );
+    ASSERT_TRUE( tokens[  8 ].is( booleval::token::token_type::field       ) );
+    ASSERT_TRUE( tokens[  9 ].is( booleval::token::token_type::not_in      ) );
+    ASSERT_TRUE( tokens[ 10 ].is( booleval::token::token_type::lp          ) );
+    ASSERT_TRUE( tokens[ 11 ].is( booleval::token::token_type::field       ) );
+    ASSERT_EQ  ( tokens[ 11 ].value(), "not" );
+    ASSERT_TRUE( tokens[ 12 ].is( booleval::token::token_type::comma       ) );
+    ASSERT_TRUE( tokens[ 13 ].is( booleval::token::token_type::field       ) );
+    ASSERT_TRUE( tokens[ 14 ].is( booleval::token::token_type::rp          ) );
+
+    // negation keyword not followed by 'in' is a field
+    ASSERT_TRUE( tokens[ 15 ].is( booleval::token::token_type::logical_or ) );
+    ASSERT_TRUE( tokens[ 16 ].is( booleval::token::token_type::field      ) );
+    ASSERT_EQ  ( tokens[ 16 ].value(), "not" );
+    ASSERT_TRUE( tokens[ 17 ].is( booleval::token::token_type::eq         ) );
+    ASSERT_TRUE( tokens[ 18 ].is( booleval::token::token_type::field      ) );
+}
+
+TEST( TokenizerTest, CommaOutsideOfSetExpression )
+{
+    auto const tokens{ booleval::token::tokenize( "field_a foo,bar and (field_b ,baz or field_c in (1,2)) and field_d qux," ) };
+    ASSERT_EQ( std::size( tokens ), 21u );
+
+    // comma is a part of the value outside of the set
+    ASSERT_TRUE( tokens[ 2 ].is( booleval::token::token_type::field ) );
+    ASSERT_EQ  ( tokens[ 2 ].value(), "foo,bar" );
+    ASSERT_TRUE( tokens[ 7 ].is( booleval::token::token_type::field ) );
+    ASSERT_EQ  ( tokens[ 7 ].value(), ",baz" );
+
+    // while it separates the values inside of the set
+    ASSERT_TRUE( tokens[ 11 ].is( booleval::token::token_type::lp    ) );
+    ASSERT_EQ  ( tokens[ 12 ].value(), "1" );
+    ASSERT_TRUE( tokens[ 13 ].is( booleval::token::token_type::comma ) );
+    ASSERT_EQ  ( tokens[ 14 ].value(), "2" );
+    ASSERT_TRUE( tokens[ 15 ].is( booleval::token::token_type::rp    ) );
+    ASSERT_TRUE( tokens[ 16 ].is( booleval::token::token_type::rp    ) );
+
+    ASSERT_TRUE( tokens[ 20 ].is( booleval::token::token_type::field ) );
+    ASSERT_EQ  ( tokens[ 20 ].value(), "qux," );
+}
+
+TEST( TokenizerTest, ParameterExpression )
+{
+    auto const tokens{ booleval::token::tokenize( "field_a gt ? and field_b ? and field_c in (?) or field_d \"?\"" ) };
+    ASSERT_EQ( std::size( tokens ), 17u );
+
+    ASSERT_TRUE( tokens[ 2 ].is( booleval::token::token_type::parameter ) );
+    ASSERT_EQ  ( tokens[ 2 ].value(), "?" );
+
+    // equal to operator is inserted between the field and the parameter
+    ASSERT_TRUE( tokens[ 5 ].is( booleval::token::token_type::eq        ) );
+    ASSERT_TRUE( tokens[ 6 ].is( booleval::token::token_type::parameter ) );
+
+    ASSERT_TRUE( tokens[ 10 ].is( booleval::token::token_type::lp        ) );
+    ASSERT_TRUE( tokens[ 11 ].is( booleval::token::token_type::parameter ) );
+    ASSERT_TRUE( tokens[ 12 ].is( booleval::token::token_type::rp        ) );
+
+    // quoted question mark is a field
+    ASSERT_TRUE( tokens[ 16 ].is( booleval::token::token_type::field ) );
+    ASSERT_EQ  ( tokens[ 16 ].value(), "?" );
+}
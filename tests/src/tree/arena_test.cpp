@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <string>
+#include <gtest/gtest.h>
+
+#include <booleval/token/token.hpp>
+#include <booleval/token/token_type.hpp>
+#include <booleval/tree/arena.hpp>
+
+TEST( ArenaTest, DefaultConstructor )
+{
+    booleval::tree::arena arena{};
+    ASSERT_TRUE( arena.empty()                           );
+    ASSERT_EQ  ( arena.size(), 0u                        );
+    ASSERT_EQ  ( arena.root(), booleval::tree::null_node );
+    ASSERT_EQ  ( arena.text(), ""                        );
+}
+
+TEST( ArenaTest, Emplace )
+{
+    using namespace booleval;
+
+    tree::arena arena{};
+
+    auto const text{ arena.text( "field foo" ) };
+
+    auto const left { arena.emplace( token::token{ token::token_type::field, text.substr( 0, 5 ) } ) };
+    auto const right{ arena.emplace( token::token{ token::token_type::field, text.substr( 6, 3 ) } ) };
+    auto const eq   { arena.emplace( token::token_type::eq, left, right )                           };
+
+    arena.root( eq );
+
+    ASSERT_FALSE( arena.empty()             );
+    ASSERT_EQ   ( arena.size(), 3u          );
+    ASSERT_EQ   ( arena.root(), 2u          );
+    ASSERT_EQ   ( arena.text(), "field foo" );
+
+    ASSERT_EQ( arena[ left  ].offset, 0u );
+    ASSERT_EQ( arena[ left  ].length, 5u );
+    ASSERT_EQ( arena[ right ].offset, 6u );
+    ASSERT_EQ( arena[ right ].length, 3u );
+
+    ASSERT_EQ( arena.value( arena[ left  ] ), "field" );
+    ASSERT_EQ( arena.value( arena[ right ] ), "foo"   );
+    ASSERT_EQ( arena.value( arena[ eq    ] ), "eq"    );
+
+    ASSERT_EQ( arena.token( arena[ eq ] ), token::token{ token::token_type::eq } );
+}
+
+TEST( ArenaTest, EmplaceValueOutsideOfText )
+{
+    using namespace booleval;
+
+    tree::arena arena{};
+
+    std::string const value{ "bar" };
+
+    auto const index{ arena.emplace( token::token{ token::token_type::field, value } ) };
+
+    ASSERT_EQ( arena.text(), "bar"                  );
+    ASSERT_EQ( arena.value( arena[ index ] ), "bar" );
+}
+
+TEST( ArenaTest, EmplaceList )
+{
+    using namespace booleval;
+
+    tree::arena arena{};
+
+    auto const text{ arena.text( "a b c" ) };
+
+    auto const first{ arena.extra_size() };
+    arena.extra( arena.emplace( token::token{ token::token_type::field, text.substr( 0, 1 ) } ) );
+    arena.extra( arena.emplace( token::token{ token::token_type::field, text.substr( 2, 1 ) } ) );
+    arena.extra( arena.emplace( token::token{ token::token_type::field, text.substr( 4, 1 ) } ) );
+
+    auto const list{ arena.emplace_list( token::token_type::lp, first ) };
+    ASSERT_FALSE( arena[ list ].has_children() );
+
+    auto const elements{ arena.list( arena[ list ] ) };
+    ASSERT_EQ( std::size( elements ), 3u );
+    ASSERT_EQ( arena.value( arena[ elements[ 0 ] ] ), "a" );
+    ASSERT_EQ( arena.value( arena[ elements[ 1 ] ] ), "b" );
+    ASSERT_EQ( arena.value( arena[ elements[ 2 ] ] ), "c" );
+
+    arena.clear();
+    ASSERT_EQ( arena.extra_size(), 0u );
+}
+
+TEST( ArenaTest, EmplaceLogical )
+{
+    using namespace booleval;
+
+    tree::arena arena{};
+
+    auto const left { arena.emplace( token::token_type::eq ) };
+    auto const right{ arena.emplace( token::token_type::eq ) };
+
+    // operands of the logical operation are kept in the extra storage
+    auto const logical{ arena.emplace( token::token_type::logical_or, left, right ) };
+    ASSERT_TRUE( arena[ logical ].is_logical()   );
+    ASSERT_TRUE( arena[ logical ].has_children() );
+    ASSERT_EQ  ( arena[ logical ].left , tree::null_node );
+    ASSERT_EQ  ( arena[ logical ].right, tree::null_node );
+
+    auto const operands{ arena.list( arena[ logical ] ) };
+    ASSERT_EQ( std::size( operands ), 2u );
+    ASSERT_EQ( operands[ 0 ], left       );
+    ASSERT_EQ( operands[ 1 ], right      );
+
+    ASSERT_FALSE( arena[ arena.emplace( token::token_type::logical_and ) ].has_children() );
+}
+
+TEST( ArenaTest, Clear )
+{
+    using namespace booleval;
+
+    tree::arena arena{};
+
+    arena.text( "field foo" );
+    arena.root( arena.emplace( token::token_type::eq ) );
+
+    arena.clear();
+
+    ASSERT_TRUE( arena.empty()    );
+    ASSERT_EQ  ( arena.size(), 0u );
+    ASSERT_EQ  ( arena.text(), "" );
+}
@@ -30,40 +30,31 @@
 #include <gtest/gtest.h>
 
 #include <booleval/token/token_type.hpp>
-#include <booleval/token/token.hpp>
 #include <booleval/tree/node.hpp>
 
 TEST( NodeTest, DefaultConstructor )
 {
     booleval::tree::node node{};
-    ASSERT_EQ( node.token.type(), booleval::token::token_type::unknown );
-    ASSERT_EQ( node.left , nullptr );
-    ASSERT_EQ( node.right, nullptr );
+    ASSERT_EQ   ( node.type, booleval::token::token_type::unknown );
+    ASSERT_EQ   ( node.left , booleval::tree::null_node           );
+    ASSERT_EQ   ( node.right, booleval::tree::null_node           );
+    ASSERT_FALSE( node.has_children()                             );
 }
 
 TEST( NodeTest, ConstructorFromTokenType )
 {
     booleval::tree::node node{ booleval::token::token_type::logical_and };
-    ASSERT_EQ( node.token.type(), booleval::token::token_type::logical_and );
-    ASSERT_EQ( node.left , nullptr );
-    ASSERT_EQ( node.right, nullptr );
+    ASSERT_EQ   ( node.type, booleval::token::token_type::logical_and );
+    ASSERT_EQ   ( node.left , booleval::tree::null_node               );
+    ASSERT_EQ   ( node.right, booleval::tree::null_node               );
+    ASSERT_FALSE( node.has_children()                                 );
 }
 
-TEST( NodeTest, ConstructorFromToken )
+TEST( NodeTest, ConstructorFromTokenTypeAndChildren )
 {
-    {
-        booleval::token::token and_token{ booleval::token::token_type::logical_and };
-        booleval::tree::node node{ and_token };
-        ASSERT_EQ( node.token.type(), booleval::token::token_type::logical_and );
-        ASSERT_EQ( node.left , nullptr );
-        ASSERT_EQ( node.right, nullptr );
-    }
-    {
-        booleval::token::token field_token{ "foo" };
-        booleval::tree::node node{ field_token };
-        ASSERT_EQ( node.token.value(), "foo" );
-        ASSERT_EQ( node.token.type(), booleval::token::token_type::field );
-        ASSERT_EQ( node.left , nullptr );
-        ASSERT_EQ( node.right, nullptr );
-    }
+    booleval::tree::node node{ booleval::token::token_type::eq, 0u, 1u };
+    ASSERT_EQ  ( node.type, booleval::token::token_type::eq );
+    ASSERT_EQ  ( node.left , 0u                             );
+    ASSERT_EQ  ( node.right, 1u                             );
+    ASSERT_TRUE( node.has_children()                        );
 }
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <gtest/gtest.h>
+
+#include <booleval/field.hpp>
+#include <booleval/tree/tree.hpp>
+#include <booleval/tree/arena.hpp>
+#include <booleval/tree/optimizer.hpp>
+#include <booleval/tree/result_visitor.hpp>
+
+namespace
+{
+
+    template< typename T, typename U >
+    class bar
+    {
+    public:
+        bar( T && value_1, U && value_2 )
+        : value_1_{ value_1 }
+        , value_2_{ value_2 }
+        {}
+
+        T value_1() const noexcept { return value_1_; }
+        U value_2() const noexcept { return value_2_; }
+
+    private:
+        T value_1_{};
+        U value_2_{};
+    };
+
+    std::string elements( booleval::tree::arena const & arena, booleval::tree::node const & node )
+    {
+        std::string result;
+
+        for ( auto const element : arena.list( arena[ node.right ] ) )
+        {
+            if ( !result.empty() ) { result += ","; }
+            result += arena.value( arena[ element ] );
+        }
+
+        return result;
+    }
+
+} // namespace
+
+TEST( OptimizerTest, EmptyTree )
+{
+    booleval::tree::arena source;
+    booleval::tree::arena target;
+
+    booleval::tree::optimize( source, target );
+
+    ASSERT_TRUE( target.empty() );
+}
+
+TEST( OptimizerTest, EqualityChain )
+{
+    using namespace booleval;
+
+    tree::arena source;
+    tree::arena target;
+
+    ASSERT_TRUE( tree::build( "field_a 1 or field_a 2 or field_a 3", source ) );
+    tree::optimize( source, target );
+
+    auto const & root{ target[ target.root() ] };
+
+    ASSERT_EQ( root.type, token::token_type::in              );
+    ASSERT_EQ( target.value( target[ root.left ] ), "field_a" );
+    ASSERT_EQ( elements( target, root ), "1,2,3"             );
+}
+
+TEST( OptimizerTest, InequalityChain )
+{
+    using namespace booleval;
+
+    tree::arena source;
+    tree::arena target;
+
+    ASSERT_TRUE( tree::build( "field_a neq foo and (field_a neq bar and field_a not in (baz, qux))", source ) );
+    tree::optimize( source, target );
+
+    auto const & root{ target[ target.root() ] };
+
+    ASSERT_EQ( root.type, token::token_type::not_in          );
+    ASSERT_EQ( target.value( target[ root.left ] ), "field_a" );
+    ASSERT_EQ( elements( target, root ), "foo,bar,baz,qux"   );
+}
+
+TEST( OptimizerTest, MixedChain )
+{
+    using namespace booleval;
+
+    tree::arena source;
+    tree::arena target;
+
+    ASSERT_TRUE( tree::build( "field_b 0 or field_a 1 or field_c gt 5 or field_a 2 or field_b neq 3", source ) );
+    tree::optimize( source, target );
+
+    // 'field_b 0' and 'field_b neq 3' are not folded, as only equalities are folded into 'in'
+    auto const & root    { target[ target.root() ] };
+    auto const   operands{ target.list( root )     };
+
+    ASSERT_EQ( root.type, token::token_type::logical_or );
+    ASSERT_EQ( std::size( operands ), 4u                );
+
+    ASSERT_EQ( target[ operands[ 0 ] ].type, token::token_type::eq  );
+    ASSERT_EQ( target[ operands[ 1 ] ].type, token::token_type::in  );
+    ASSERT_EQ( elements( target, target[ operands[ 1 ] ] ), "1,2"   );
+    ASSERT_EQ( target[ operands[ 2 ] ].type, token::token_type::gt  );
+    ASSERT_EQ( target[ operands[ 3 ] ].type, token::token_type::neq );
+}
+
+TEST( OptimizerTest, DifferentOperations )
+{
+    using namespace booleval;
+
+    tree::arena source;
+    tree::arena target;
+
+    // equalities combined with 'and' and inequalities combined with 'or' are not folded
+    ASSERT_TRUE( tree::build( "(field_a 1 and field_a 2) or (field_a neq 3 or field_a neq 4)", source ) );
+    tree::optimize( source, target );
+
+    // nested 'or' is merged into the outer one, while none of the operands is folded
+    ASSERT_EQ( target.size(), source.size() - 1u );
+    ASSERT_EQ( std::size( target.list( target[ target.root() ] ) ), 3u );
+
+    for ( auto const & node : target )
+    {
+        ASSERT_TRUE( node.type != token::token_type::in && node.type != token::token_type::not_in );
+    }
+}
+
+TEST( OptimizerTest, Parameters )
+{
+    using namespace booleval;
+
+    tree::arena source;
+    tree::arena target;
+
+    // parameters are bound separately, so they are not folded into the set
+    ASSERT_TRUE( tree::build( "field_a ? or field_a 1 or field_a in (?) or field_a 2", source ) );
+    tree::optimize( source, target );
+
+    ASSERT_EQ( target.parameters(), 2u );
+
+    auto const operands{ target.list( target[ target.root() ] ) };
+
+    ASSERT_EQ( std::size( operands ), 3u );
+
+    auto const & first{ target[ operands[ 0 ] ] };
+
+    ASSERT_EQ( first.type, token::token_type::eq                        );
+    ASSERT_EQ( target[ first.right ].type, token::token_type::parameter );
+    ASSERT_EQ( elements( target, target[ operands[ 1 ] ] ), "1,2"       );
+    ASSERT_EQ( target[ operands[ 2 ] ].type, token::token_type::in      );
+}
+
+TEST( OptimizerTest, SameResultAsOriginalTree )
+{
+    using namespace booleval;
+
+    using object = bar< std::string, unsigned >;
+
+    std::array objects
+    {
+        object{ "foo", 1 },
+        object{ "bar", 2 },
+        object{ "baz", 3 },
+        object{ "3",   4 }
+    };
+
+    std::array expressions
+    {
+        "field_1 foo or field_1 bar",
+        "field_1 foo or field_2 4 or field_1 baz",
+        "field_1 neq foo and field_1 neq bar",
+        "field_2 neq 1 and field_2 neq 2 and field_2 neq 3",
+        "field_2 neq 1 and field_2 neq foo",
+        "field_1 neq 3 and field_1 neq foo",
+        "field_2 1 or field_2 foo or field_2 4.0",
+        "(field_1 foo or field_1 bar) and (field_2 2 or field_2 3)",
+        "field_2 neq 1 and (field_2 neq 2 or field_1 neq bar) and field_2 not in (3)",
+        "field_1 in (foo) or field_1 3 or (field_2 gt 1 and field_2 lt 3)",
+    };
+
+    tree::result_visitor visitor;
+    visitor.fields
+    (
+        {
+            make_field( "field_1", &object::value_1 ),
+            make_field( "field_2", &object::value_2 )
+        }
+    );
+
+    tree::arena source;
+    tree::arena target;
+
+    for ( std::string_view const expression : expressions )
+    {
+        ASSERT_TRUE( tree::build( expression, source ) ) << expression;
+        tree::optimize( source, target );
+
+        for ( auto & obj : objects )
+        {
+            ASSERT_EQ( visitor.visit( target, obj ).success, visitor.visit( source, obj ).success ) << expression;
+        }
+    }
+}
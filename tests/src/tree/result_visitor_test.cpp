@@ -27,8 +27,11 @@
  *
  */
 
+#include <string>
 #include <gtest/gtest.h>
 #include <booleval/tree/node.hpp>
+#include <booleval/tree/tree.hpp>
+#include <booleval/tree/arena.hpp>
 #include <booleval/token/token_type.hpp>
 #include <booleval/tree/result_visitor.hpp>
 
@@ -70,14 +73,20 @@ namespace
         U value_2_{};
     };
 
-    std::unique_ptr< booleval::tree::node > make_tree_node( booleval::token::token_type const type ) noexcept
+    booleval::tree::node_index make_relational_node
+    (
+        booleval::tree::arena             & arena,
+        booleval::token::token_type const   type,
+        std::string_view            const   key,
+        std::string_view            const   value
+    )
     {
-        return std::make_unique< booleval::tree::node >( type );
-    }
+        using namespace booleval;
 
-    std::unique_ptr< booleval::tree::node > make_tree_node( booleval::token::token_type const type, std::string_view const value ) noexcept
-    {
-        return std::make_unique< booleval::tree::node >( booleval::token::token{ type, value } );
+        auto const left { arena.emplace( token::token{ token::token_type::field, key   } ) };
+        auto const right{ arena.emplace( token::token{ token::token_type::field, value } ) };
+
+        return arena.emplace( type, left, right );
     }
 
 } // namespace
@@ -100,20 +109,16 @@ TEST( ResultVisitorTest, AndTreeNode )
         }
     );
 
-    auto and_op{ make_tree_node( token::token_type::logical_and ) };
-
-    and_op->left  = make_tree_node( token::token_type::eq );
-    and_op->right = make_tree_node( token::token_type::eq );
+    tree::arena arena;
 
-    and_op->left->left  = make_tree_node( token::token_type::field, "field_1" );
-    and_op->left->right = make_tree_node( token::token_type::field, "1"       );
+    auto const left { make_relational_node( arena, token::token_type::eq, "field_1", "1" ) };
+    auto const right{ make_relational_node( arena, token::token_type::eq, "field_2", "2" ) };
 
-    and_op->right->left  = make_tree_node( token::token_type::field, "field_2" );
-    and_op->right->right = make_tree_node( token::token_type::field, "2"       );
+    arena.root( arena.emplace( token::token_type::logical_and, left, right ) );
 
-    ASSERT_TRUE ( visitor.visit( *and_op, x ).success );
-    ASSERT_FALSE( visitor.visit( *and_op, y ).success );
-    ASSERT_FALSE( visitor.visit( *and_op, z ).success );
+    ASSERT_TRUE ( visitor.visit( arena, x ).success );
+    ASSERT_FALSE( visitor.visit( arena, y ).success );
+    ASSERT_FALSE( visitor.visit( arena, z ).success );
 }
 
 TEST( ResultVisitorTest, OrTreeNode )
@@ -132,20 +137,131 @@ TEST( ResultVisitorTest, OrTreeNode )
         }
     );
 
-    auto or_op{ make_tree_node( token::token_type::logical_or ) };
+    tree::arena arena;
+
+    auto const left { make_relational_node( arena, token::token_type::eq, "field", "1" ) };
+    auto const right{ make_relational_node( arena, token::token_type::eq, "field", "2" ) };
+
+    arena.root( arena.emplace( token::token_type::logical_or, left, right ) );
+
+    ASSERT_TRUE ( visitor.visit( arena, x ).success );
+    ASSERT_TRUE ( visitor.visit( arena, y ).success );
+    ASSERT_FALSE( visitor.visit( arena, z ).success );
+}
+
+TEST( ResultVisitorTest, ShortCircuitAndTreeNode )
+{
+    using namespace booleval;
+
+    foo< unsigned > x{ 1 };
+    foo< unsigned > y{ 2 };
+
+    tree::result_visitor visitor;
+    visitor.fields
+    (
+        {
+            make_field( "field", &foo< unsigned >::value )
+        }
+    );
+
+    tree::arena arena;
+
+    auto const left { make_relational_node( arena, token::token_type::eq, "field"        , "1" ) };
+    auto const right{ make_relational_node( arena, token::token_type::eq, "unknown_field", "1" ) };
+
+    arena.root( arena.emplace( token::token_type::logical_and, left, right ) );
+
+    {
+        auto const result{ visitor.visit( arena, x ) };
+        ASSERT_FALSE( result.success                  );
+        ASSERT_EQ   ( result.message, "Unknown field" );
+    }
+    {
+        // right operand is not visited since the left one is already false
+        auto const result{ visitor.visit( arena, y ) };
+        ASSERT_FALSE( result.success         );
+        ASSERT_TRUE ( result.message.empty() );
+    }
+}
+
+TEST( ResultVisitorTest, ShortCircuitOrTreeNode )
+{
+    using namespace booleval;
+
+    foo< unsigned > x{ 1 };
+    foo< unsigned > y{ 2 };
+
+    tree::result_visitor visitor;
+    visitor.fields
+    (
+        {
+            make_field( "field", &foo< unsigned >::value )
+        }
+    );
+
+    tree::arena arena;
+
+    auto const left { make_relational_node( arena, token::token_type::eq, "unknown_field", "1" ) };
+    auto const right{ make_relational_node( arena, token::token_type::eq, "field"        , "1" ) };
+
+    arena.root( arena.emplace( token::token_type::logical_or, left, right ) );
+
+    {
+        // error message of the leftmost failed operand is kept
+        auto const result{ visitor.visit( arena, x ) };
+        ASSERT_TRUE( result.success                  );
+        ASSERT_EQ  ( result.message, "Unknown field" );
+    }
+    {
+        auto const result{ visitor.visit( arena, y ) };
+        ASSERT_FALSE( result.success                  );
+        ASSERT_EQ   ( result.message, "Unknown field" );
+    }
+
+    arena.root( arena.emplace( token::token_type::logical_or, right, left ) );
+
+    {
+        // right operand is not visited since the left one is already true
+        auto const result{ visitor.visit( arena, x ) };
+        ASSERT_TRUE( result.success         );
+        ASSERT_TRUE( result.message.empty() );
+    }
+    {
+        auto const result{ visitor.visit( arena, y ) };
+        ASSERT_FALSE( result.success                  );
+        ASSERT_EQ   ( result.message, "Unknown field" );
+    }
+}
+
+TEST( ResultVisitorTest, LogicalChainTreeNode )
+{
+    using namespace booleval;
 
-    or_op->left  = make_tree_node( token::token_type::eq );
-    or_op->right = make_tree_node( token::token_type::eq );
+    foo< unsigned > x{ 0     };
+    foo< unsigned > y{ 9999  };
+    foo< unsigned > z{ 10000 };
 
-    or_op->left->left  = make_tree_node( token::token_type::field, "field" );
-    or_op->left->right = make_tree_node( token::token_type::field, "1"     );
+    tree::result_visitor visitor;
+    visitor.fields
+    (
+        {
+            make_field( "field", &foo< unsigned >::value )
+        }
+    );
+
+    std::string expression{ "field 0" };
+    for ( auto i{ 1 }; i < 10000; ++i )
+    {
+        expression += " or field " + std::to_string( i );
+    }
 
-    or_op->right->left  = make_tree_node( token::token_type::field, "field" );
-    or_op->right->right = make_tree_node( token::token_type::field, "2"     );
+    tree::arena arena;
+    ASSERT_TRUE( tree::build( expression, arena ) );
 
-    ASSERT_TRUE ( visitor.visit( *or_op, x ).success );
-    ASSERT_TRUE ( visitor.visit( *or_op, y ).success );
-    ASSERT_FALSE( visitor.visit( *or_op, z ).success );
+    // operands are visited in a loop, so the long chain does not nest the calls
+    ASSERT_TRUE ( visitor.visit( arena, x ).success );
+    ASSERT_TRUE ( visitor.visit( arena, y ).success );
+    ASSERT_FALSE( visitor.visit( arena, z ).success );
 }
 
 TEST( ResultVisitorTest, EqualToTreeNode )
@@ -163,13 +279,12 @@ TEST( ResultVisitorTest, EqualToTreeNode )
         }
     );
 
-    auto eq_op{ make_tree_node( token::token_type::eq ) };
+    tree::arena arena;
 
-    eq_op->left  = make_tree_node( token::token_type::field, "field" );
-    eq_op->right = make_tree_node( token::token_type::field, "1"     );
+    arena.root( make_relational_node( arena, token::token_type::eq, "field", "1" ) );
 
-    ASSERT_TRUE ( visitor.visit( *eq_op, x ).success );
-    ASSERT_FALSE( visitor.visit( *eq_op, y ).success );
+    ASSERT_TRUE ( visitor.visit( arena, x ).success );
+    ASSERT_FALSE( visitor.visit( arena, y ).success );
 }
 
 TEST( ResultVisitorTest, NotEqualToTreeNode )
@@ -187,13 +302,12 @@ TEST( ResultVisitorTest, NotEqualToTreeNode )
         }
     );
 
-    auto neq_op{ make_tree_node( token::token_type::neq ) };
+    tree::arena arena;
 
-    neq_op->left  = make_tree_node( token::token_type::field, "field" );
-    neq_op->right = make_tree_node( token::token_type::field, "1"     );
+    arena.root( make_relational_node( arena, token::token_type::neq, "field", "1" ) );
 
-    ASSERT_FALSE( visitor.visit( *neq_op, x ).success );
-    ASSERT_TRUE ( visitor.visit( *neq_op, y ).success );
+    ASSERT_FALSE( visitor.visit( arena, x ).success );
+    ASSERT_TRUE ( visitor.visit( arena, y ).success );
 }
 
 TEST( ResultVisitorTest, GreaterThanTreeNode )
@@ -212,14 +326,13 @@ TEST( ResultVisitorTest, GreaterThanTreeNode )
         }
     );
 
-    auto gt_op{ make_tree_node( token::token_type::gt ) };
+    tree::arena arena;
 
-    gt_op->left  = make_tree_node( token::token_type::field, "field" );
-    gt_op->right = make_tree_node( token::token_type::field, "1"     );
+    arena.root( make_relational_node( arena, token::token_type::gt, "field", "1" ) );
 
-    ASSERT_FALSE( visitor.visit( *gt_op, x ).success );
-    ASSERT_FALSE( visitor.visit( *gt_op, y ).success );
-    ASSERT_TRUE ( visitor.visit( *gt_op, z ).success );
+    ASSERT_FALSE( visitor.visit( arena, x ).success );
+    ASSERT_FALSE( visitor.visit( arena, y ).success );
+    ASSERT_TRUE ( visitor.visit( arena, z ).success );
 }
 
 TEST( ResultVisitorTest, LessThanTreeNode )
@@ -238,14 +351,13 @@ TEST( ResultVisitorTest, LessThanTreeNode )
         }
     );
 
-    auto lt_op{ make_tree_node( token::token_type::lt ) };
+    tree::arena arena;
 
-    lt_op->left  = make_tree_node( token::token_type::field, "field" );
-    lt_op->right = make_tree_node( token::token_type::field, "1"     );
+    arena.root( make_relational_node( arena, token::token_type::lt, "field", "1" ) );
 
-    ASSERT_TRUE ( visitor.visit( *lt_op, x ).success );
-    ASSERT_FALSE( visitor.visit( *lt_op, y ).success );
-    ASSERT_FALSE( visitor.visit( *lt_op, z ).success );
+    ASSERT_TRUE ( visitor.visit( arena, x ).success );
+    ASSERT_FALSE( visitor.visit( arena, y ).success );
+    ASSERT_FALSE( visitor.visit( arena, z ).success );
 }
 
 TEST( ResultVisitorTest, GreaterThanOrEqualToTreeNode )
@@ -264,14 +376,13 @@ TEST( ResultVisitorTest, GreaterThanOrEqualToTreeNode )
         }
     );
 
-    auto geq_op{ make_tree_node( token::token_type::geq ) };
+    tree::arena arena;
 
-    geq_op->left  = make_tree_node( token::token_type::field, "field" );
-    geq_op->right = make_tree_node( token::token_type::field, "1"     );
+    arena.root( make_relational_node( arena, token::token_type::geq, "field", "1" ) );
 
-    ASSERT_FALSE( visitor.visit( *geq_op, x ).success );
-    ASSERT_TRUE ( visitor.visit( *geq_op, y ).success );
-    ASSERT_TRUE ( visitor.visit( *geq_op, z ).success );
+    ASSERT_FALSE( visitor.visit( arena, x ).success );
+    ASSERT_TRUE ( visitor.visit( arena, y ).success );
+    ASSERT_TRUE ( visitor.visit( arena, z ).success );
 }
 
 TEST( ResultVisitorTest, LessThanOrEqualToTreeNode )
@@ -290,14 +401,13 @@ TEST( ResultVisitorTest, LessThanOrEqualToTreeNode )
         }
     );
 
-    auto leq_op{ make_tree_node( token::token_type::leq ) };
+    tree::arena arena;
 
-    leq_op->left  = make_tree_node( token::token_type::field, "field" );
-    leq_op->right = make_tree_node( token::token_type::field, "1"     );
+    arena.root( make_relational_node( arena, token::token_type::leq, "field", "1" ) );
 
-    ASSERT_TRUE ( visitor.visit( *leq_op, x ).success );
-    ASSERT_TRUE ( visitor.visit( *leq_op, y ).success );
-    ASSERT_FALSE( visitor.visit( *leq_op, z ).success );
+    ASSERT_TRUE ( visitor.visit( arena, x ).success );
+    ASSERT_TRUE ( visitor.visit( arena, y ).success );
+    ASSERT_FALSE( visitor.visit( arena, z ).success );
 }
 
 TEST( ResultVisitorTest, UnknownTreeNode )
@@ -315,18 +425,17 @@ TEST( ResultVisitorTest, UnknownTreeNode )
         }
     );
 
-    auto eq_op{ make_tree_node( token::token_type::eq ) };
+    tree::arena arena;
 
-    eq_op->left  = make_tree_node( token::token_type::field, "unknown_field" );
-    eq_op->right = make_tree_node( token::token_type::field, "1"             );
+    arena.root( make_relational_node( arena, token::token_type::eq, "unknown_field", "1" ) );
 
     {
-        auto const result{ visitor.visit( *eq_op, x ) };
+        auto const result{ visitor.visit( arena, x ) };
         ASSERT_FALSE( result.success                  );
         ASSERT_EQ   ( result.message, "Unknown field" );
     }
     {
-        auto const result{ visitor.visit( *eq_op, y ) };
+        auto const result{ visitor.visit( arena, y ) };
         ASSERT_FALSE( result.success                  );
         ASSERT_EQ   ( result.message, "Unknown field" );
     }
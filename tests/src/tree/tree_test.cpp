@@ -27,45 +27,233 @@
  *
  */
 
+#include <string>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include <booleval/tree/tree.hpp>
 
 TEST( TreeTest, RelationalOperation )
 {
-    ASSERT_EQ( booleval::tree::build( "field_a" ), nullptr );
+    booleval::tree::arena arena;
 
-    ASSERT_NE( booleval::tree::build( "field_a foo" ), nullptr );
+    ASSERT_FALSE( booleval::tree::build( "field_a", arena ) );
+
+    ASSERT_TRUE ( booleval::tree::build( "field_a foo", arena ) );
 }
 
 TEST( TreeTest, AndOperation )
 {
-    ASSERT_EQ( booleval::tree::build( "and"             ), nullptr );
-    ASSERT_EQ( booleval::tree::build( " and "           ), nullptr );
-    ASSERT_EQ( booleval::tree::build( "field_a foo and" ), nullptr );
+    booleval::tree::arena arena;
+
+    ASSERT_FALSE( booleval::tree::build( "and",             arena ) );
+    ASSERT_FALSE( booleval::tree::build( " and ",           arena ) );
+    ASSERT_FALSE( booleval::tree::build( "field_a foo and", arena ) );
 
-    ASSERT_NE( booleval::tree::build( "field_a foo and field_b bar" ), nullptr );
+    ASSERT_TRUE ( booleval::tree::build( "field_a foo and field_b bar", arena ) );
 }
 
 TEST( TreeTest, OrOperation )
 {
-    ASSERT_EQ( booleval::tree::build( "or"             ), nullptr );
-    ASSERT_EQ( booleval::tree::build( " or "           ), nullptr );
-    ASSERT_EQ( booleval::tree::build( "field_a foo or" ), nullptr );
-    ASSERT_EQ( booleval::tree::build( "or field_b bar" ), nullptr );
+    booleval::tree::arena arena;
 
-    ASSERT_NE( booleval::tree::build( "field_a foo or field_b bar" ), nullptr );
+    ASSERT_FALSE( booleval::tree::build( "or",             arena ) );
+    ASSERT_FALSE( booleval::tree::build( " or ",           arena ) );
+    ASSERT_FALSE( booleval::tree::build( "field_a foo or", arena ) );
+    ASSERT_FALSE( booleval::tree::build( "or field_b bar", arena ) );
+
+    ASSERT_TRUE ( booleval::tree::build( "field_a foo or field_b bar", arena ) );
+}
+
+TEST( TreeTest, InOperation )
+{
+    booleval::tree::arena arena;
+
+    ASSERT_FALSE( booleval::tree::build( "field_a in",             arena ) );
+    ASSERT_FALSE( booleval::tree::build( "field_a in ()",          arena ) );
+    ASSERT_FALSE( booleval::tree::build( "field_a in foo",         arena ) );
+    ASSERT_FALSE( booleval::tree::build( "field_a in (foo",        arena ) );
+    ASSERT_FALSE( booleval::tree::build( "field_a in (foo,)",      arena ) );
+    ASSERT_FALSE( booleval::tree::build( "field_a in (foo bar)",   arena ) );
+    ASSERT_FALSE( booleval::tree::build( "field_a foo in (bar)",   arena ) );
+
+    ASSERT_TRUE ( booleval::tree::build( "field_a in (foo)", arena ) );
+    ASSERT_TRUE ( booleval::tree::build( "field_a not in (foo, bar) and field_b IN (1,2,3)", arena ) );
+
+    auto const & root{ arena[ arena.root() ] };
+    ASSERT_EQ( root.type, booleval::token::token_type::logical_and );
+
+    auto const operands{ arena.list( root ) };
+    ASSERT_EQ( std::size( operands ), 2u );
+
+    auto const & not_in{ arena[ operands[ 0 ] ] };
+    ASSERT_EQ( not_in.type, booleval::token::token_type::not_in );
+    ASSERT_EQ( arena.value( arena[ not_in.left ] ), "field_a" );
+
+    auto const elements{ arena.list( arena[ not_in.right ] ) };
+    ASSERT_EQ( std::size( elements ), 2u );
+    ASSERT_EQ( arena.value( arena[ elements[ 0 ] ] ), "foo" );
+    ASSERT_EQ( arena.value( arena[ elements[ 1 ] ] ), "bar" );
+
+    auto const & in{ arena[ operands[ 1 ] ] };
+    ASSERT_EQ( in.type, booleval::token::token_type::in      );
+    ASSERT_EQ( std::size( arena.list( arena[ in.right ] ) ), 3u );
+}
+
+TEST( TreeTest, Parameters )
+{
+    booleval::tree::arena arena;
+
+    ASSERT_FALSE( booleval::tree::build( "? gt 1",                arena ) );
+    ASSERT_FALSE( booleval::tree::build( "field_a in ?",          arena ) );
+    ASSERT_FALSE( booleval::tree::build( "field_a in (?, foo)",   arena ) );
+    ASSERT_FALSE( booleval::tree::build( "field_a in (foo, ?)",   arena ) );
+
+    ASSERT_TRUE ( booleval::tree::build( "field_a gt ? and field_b in (?) or field_c ?", arena ) );
+    ASSERT_EQ   ( arena.parameters(), 3u );
+
+    // parameters are numbered in the order of their appearance
+    auto const or_operands { arena.list( arena[ arena.root() ] ) };
+    auto const and_operands{ arena.list( arena[ or_operands[ 0 ] ] ) };
+
+    ASSERT_EQ( arena[ arena[ and_operands[ 0 ] ].right ].type, booleval::token::token_type::parameter );
+    ASSERT_EQ( arena[ arena[ and_operands[ 0 ] ].right ].offset, 0u );
+    ASSERT_EQ( arena[ arena.list( arena[ arena[ and_operands[ 1 ] ].right ] )[ 0 ] ].offset, 1u );
+    ASSERT_EQ( arena[ arena[ or_operands[ 1 ] ].right ].offset, 2u );
+
+    ASSERT_TRUE( booleval::tree::build( "field_a 1", arena ) );
+    ASSERT_EQ  ( arena.parameters(), 0u );
 }
 
 TEST( TreeTest, Parentheses )
 {
-    ASSERT_EQ( booleval::tree::build( "(field_a foo or field_b bar"  ), nullptr );
-    ASSERT_EQ( booleval::tree::build( "( field_a foo or field_b bar" ), nullptr );
+    booleval::tree::arena arena;
+
+    ASSERT_FALSE( booleval::tree::build( "(field_a foo or field_b bar",  arena ) );
+    ASSERT_FALSE( booleval::tree::build( "( field_a foo or field_b bar", arena ) );
 
     // @todo: Fix following test cases
-    // ASSERT_EQ( booleval::tree::build( "field_a foo or field_b bar)"  ), nullptr );
-    // ASSERT_EQ( booleval::tree::build( "field_a foo or field_b bar )" ), nullptr );
+    // ASSERT_FALSE( booleval::tree::build( "field_a foo or field_b bar)",  arena ) );
+    // ASSERT_FALSE( booleval::tree::build( "field_a foo or field_b bar )", arena ) );
+
+    ASSERT_TRUE ( booleval::tree::build( "(field_a foo or field_b bar)",   arena ) );
+    ASSERT_TRUE ( booleval::tree::build( "( field_a foo or field_b bar )", arena ) );
+}
+
+TEST( TreeTest, EvaluationOrder )
+{
+    using namespace booleval;
+
+    tree::arena arena;
+
+    ASSERT_TRUE( tree::build( "field_a foo and (field_b bar or field_c baz)", arena ) );
+    ASSERT_EQ  ( arena.size(), 11u );
+
+    // child nodes always precede their parent node
+    for ( tree::node_index i{ 0u }; i < arena.size(); ++i )
+    {
+        auto const & node{ arena[ i ] };
+        if ( node.left  != tree::null_node ) { ASSERT_LT( node.left , i ); }
+        if ( node.right != tree::null_node ) { ASSERT_LT( node.right, i ); }
+
+        if ( node.is_logical() )
+        {
+            for ( auto const operand : arena.list( node ) ) { ASSERT_LT( operand, i ); }
+        }
+    }
+
+    auto const & root    { arena[ arena.root() ] };
+    auto const   operands{ arena.list( root )    };
+    ASSERT_EQ( arena.root(), arena.size() - 1u                                 );
+    ASSERT_EQ( root.type, token::token_type::logical_and                       );
+    ASSERT_EQ( arena[ operands[ 1 ] ].type, token::token_type::logical_or      );
+    ASSERT_EQ( arena.value( arena[ arena[ operands[ 0 ] ].left  ] ), "field_a" );
+    ASSERT_EQ( arena.value( arena[ arena[ operands[ 0 ] ].right ] ), "foo"     );
+}
+
+TEST( TreeTest, LogicalChain )
+{
+    using namespace booleval;
+
+    tree::arena arena;
+
+    std::string expression{ "field_a 0" };
+    for ( auto i{ 1 }; i < 10000; ++i )
+    {
+        expression += " or field_a " + std::to_string( i );
+    }
+
+    // the whole chain is represented by the single node instead of the deeply nested ones
+    ASSERT_TRUE( tree::build( expression, arena ) );
+
+    auto const & root    { arena[ arena.root() ] };
+    auto const   operands{ arena.list( root )    };
+    ASSERT_EQ( root.type, token::token_type::logical_or );
+    ASSERT_EQ( std::size( operands ), 10000u            );
+    ASSERT_EQ( arena.value( arena[ arena[ operands[ 9999 ] ].right ] ), "9999" );
+
+    ASSERT_TRUE( tree::build( "field_a 1 and field_b 2 and field_c 3 or field_d 4", arena ) );
+    ASSERT_EQ  ( arena[ arena.root() ].type, token::token_type::logical_or );
+    ASSERT_EQ  ( std::size( arena.list( arena[ arena.list( arena[ arena.root() ] )[ 0 ] ] ) ), 3u );
+}
+
+TEST( TreeTest, DeepNesting )
+{
+    using namespace booleval;
+
+    constexpr std::size_t depth{ 1000000u };
+
+    // tokens are made directly, so the nesting depth is not limited by the time of tokenizing
+    std::vector< token::token > tokens;
+
+    for ( std::size_t i{ 0u }; i < depth; ++i )
+    {
+        tokens.emplace_back( token::token_type::lp                 );
+        tokens.emplace_back( token::token_type::field, "field_a"   );
+        tokens.emplace_back( token::token_type::eq                 );
+        tokens.emplace_back( token::token_type::field, "1"         );
+        tokens.emplace_back( i % 2u == 0u ? token::token_type::logical_and : token::token_type::logical_or );
+    }
+
+    tokens.emplace_back( token::token_type::field, "field_b" );
+    tokens.emplace_back( token::token_type::eq               );
+    tokens.emplace_back( token::token_type::field, "2"       );
+
+    for ( std::size_t i{ 0u }; i < depth; ++i )
+    {
+        tokens.emplace_back( token::token_type::rp );
+    }
+
+    tree::arena arena;
+
+    tree::internal::token_cursor cursor{ tokens };
+
+    auto const root{ tree::internal::parse( cursor, arena ) };
+    ASSERT_NE( root, tree::null_node );
+    ASSERT_EQ( arena[ root ].type, token::token_type::logical_and );
+
+    // missing closing parenthesis
+    tokens.pop_back();
+    arena.clear();
+
+    tree::internal::token_cursor incomplete{ tokens };
+    ASSERT_EQ( tree::internal::parse( incomplete, arena ), tree::null_node );
+}
+
+TEST( TreeTest, Rebuild )
+{
+    using namespace booleval;
+
+    tree::arena arena;
+
+    ASSERT_TRUE( tree::build( "field_a foo or field_b bar", arena ) );
+    ASSERT_EQ  ( arena.size(), 7u );
+
+    ASSERT_TRUE( tree::build( "field_c baz", arena )                );
+    ASSERT_EQ  ( arena.size(), 3u                                   );
+    ASSERT_EQ  ( arena[ arena.root() ].type, token::token_type::eq );
 
-    ASSERT_NE( booleval::tree::build( "(field_a foo or field_b bar)"   ), nullptr );
-    ASSERT_NE( booleval::tree::build( "( field_a foo or field_b bar )" ), nullptr );
+    ASSERT_FALSE( tree::build( "field_c baz or", arena ) );
+    ASSERT_TRUE ( arena.empty()                          );
+    ASSERT_EQ   ( arena.size(), 0u                       );
 }
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <gtest/gtest.h>
+#include <booleval/evaluator.hpp>
+
+namespace
+{
+
+    class baz
+    {
+    public:
+        baz( std::string value_1, unsigned value_2, double value_3 )
+        : value_1_{ std::move( value_1 ) }
+        , value_2_{ value_2 }
+        , value_3_{ value_3 }
+        {}
+
+        std::string const & value_1() const noexcept { return value_1_; }
+        unsigned            value_2() const noexcept { return value_2_; }
+        double              value_3() const noexcept { return value_3_; }
+        std::string_view    value_4() const noexcept { return value_1_; }
+
+    private:
+        std::string value_1_{};
+        unsigned    value_2_{};
+        double      value_3_{};
+    };
+
+    struct quote
+    {
+        std::uint32_t id;
+        double        price;
+        char const *  symbol;
+    };
+
+} // namespace
+
+TEST( TypedEvaluatorTest, DefaultConstructor )
+{
+    booleval::typed_evaluator< baz > evaluator;
+    ASSERT_FALSE( evaluator.is_activated() );
+
+    baz x{ "foo", 1, 1.5 };
+
+    auto const result{ evaluator.evaluate( x ) };
+    ASSERT_FALSE( result.success                            );
+    ASSERT_EQ   ( result.message, "Evaluator not activated" );
+}
+
+TEST( TypedEvaluatorTest, TypedField )
+{
+    booleval::typed_field< baz > field{ "field_2", &baz::value_2 };
+    ASSERT_EQ( field.name, "field_2" );
+
+    baz x{ "foo", 1, 1.5 };
+    ASSERT_EQ( field.invoke( x ), "1" );
+
+    booleval::typed_field< baz > empty;
+    ASSERT_EQ( empty.invoke( x ).type(), booleval::utils::any_value::kind::none );
+}
+
+TEST( TypedEvaluatorTest, Operators )
+{
+    booleval::typed_evaluator< baz > evaluator
+    {
+        { "field_1", &baz::value_1 },
+        { "field_2", &baz::value_2 },
+        { "field_3", &baz::value_3 },
+        { "field_4", &baz::value_4 }
+    };
+
+    baz x{ "foo", 1, 1.5 };
+    baz y{ "bar", 2, 2.5 };
+
+    ASSERT_TRUE ( evaluator.expression( "field_1 foo and field_2 1" ) );
+    ASSERT_TRUE ( evaluator.evaluate( x ).success                     );
+    ASSERT_FALSE( evaluator.evaluate( y ).success                     );
+
+    ASSERT_TRUE ( evaluator.expression( "field_3 gt 2 or field_4 eq foo" ) );
+    ASSERT_TRUE ( evaluator.evaluate( x ).success                          );
+    ASSERT_TRUE ( evaluator.evaluate( y ).success                          );
+
+    ASSERT_TRUE ( evaluator.expression( "(field_2 leq 1 and field_3 lt 2) or field_1 neq bar" ) );
+    ASSERT_TRUE ( evaluator.evaluate( x ).success                                               );
+    ASSERT_FALSE( evaluator.evaluate( y ).success                                               );
+}
+
+TEST( TypedEvaluatorTest, UnknownField )
+{
+    booleval::typed_evaluator< baz > evaluator
+    {
+        { "field_1", &baz::value_1 }
+    };
+
+    ASSERT_FALSE( evaluator.expression( "field_2 1" ) );
+
+    baz x{ "foo", 1, 1.5 };
+
+    auto const result{ evaluator.evaluate( x ) };
+    ASSERT_FALSE( result.success                  );
+    ASSERT_EQ   ( result.message, "Unknown field" );
+}
+
+TEST( TypedEvaluatorTest, DataMembers )
+{
+    booleval::typed_evaluator< quote > evaluator
+    {
+        { "id",     &quote::id     },
+        { "price",  &quote::price  },
+        { "symbol", &quote::symbol }
+    };
+
+    quote x{ 1, 1.5, "foo" };
+    quote y{ 2, 2.5, "bar" };
+
+    ASSERT_TRUE ( evaluator.expression( "id 1 and price lt 2 and symbol foo" ) );
+    ASSERT_TRUE ( evaluator.evaluate( x ).success                              );
+    ASSERT_FALSE( evaluator.evaluate( y ).success                              );
+}
+
+TEST( TypedEvaluatorTest, Offsets )
+{
+    booleval::typed_evaluator< quote > evaluator
+    {
+        { "id",     booleval::field_offset< std::uint32_t >{ offsetof( quote, id     ) } },
+        { "price",  booleval::field_offset< double        >{ offsetof( quote, price  ) } },
+        { "symbol", booleval::field_offset< char const *  >{ offsetof( quote, symbol ) } }
+    };
+
+    quote x{ 1, 1.5, "foo" };
+    quote y{ 2, 2.5, "bar" };
+
+    ASSERT_TRUE ( evaluator.expression( "id 2 or price lt 2 and symbol foo" ) );
+    ASSERT_TRUE ( evaluator.evaluate( x ).success                             );
+    ASSERT_TRUE ( evaluator.evaluate( y ).success                             );
+
+    ASSERT_TRUE ( evaluator.expression( "price geq 2.5 and symbol neq foo" ) );
+    ASSERT_FALSE( evaluator.evaluate( x ).success                            );
+    ASSERT_TRUE ( evaluator.evaluate( y ).success                            );
+}
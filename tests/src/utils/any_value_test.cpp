@@ -60,6 +60,17 @@ TEST( AnyValueTest, StringValue )
     }
 }
 
+TEST( AnyValueTest, StringReference )
+{
+    // strings that are not temporaries are referred to, not copied
+    std::string string{ "abc" };
+    booleval::utils::any_value value{ string };
+    ASSERT_EQ( value, "abc" );
+
+    string[ 0 ] = 'x';
+    ASSERT_EQ( value, "xbc" );
+}
+
 TEST( AnyValueTest, Comparisons )
 {
     {
@@ -93,3 +104,92 @@ TEST( AnyValueTest, Comparisons )
         ASSERT_TRUE( value <= "2.345678" );
     }
 }
+
+TEST( AnyValueTest, ConstantComparisons )
+{
+    using booleval::utils::constant;
+
+    {
+        booleval::utils::any_value value{ 1 };
+
+        ASSERT_TRUE ( value == constant{ "1" }   );
+        ASSERT_TRUE ( value == constant{ "1U" }  );
+        ASSERT_TRUE ( value != constant{ "2" }   );
+        ASSERT_TRUE ( value >  constant{ "0.5" } );
+        ASSERT_TRUE ( value <  constant{ "2" }   );
+        ASSERT_TRUE ( value >= constant{ "1" }   );
+        ASSERT_TRUE ( value <= constant{ "1" }   );
+        ASSERT_FALSE( value == constant{ "foo" } );
+        ASSERT_FALSE( value != constant{ "foo" } );
+    }
+    {
+        booleval::utils::any_value value{ "foo" };
+
+        ASSERT_TRUE ( value == constant{ "foo" } );
+        ASSERT_TRUE ( value != constant{ "bar" } );
+        ASSERT_TRUE ( value >  constant{ "bar" } );
+        ASSERT_FALSE( value == constant{ "1" }   );
+    }
+}
+
+TEST( AnyValueTest, Kind )
+{
+    using kind = booleval::utils::any_value::kind;
+
+    ASSERT_EQ( booleval::utils::any_value{}.type(),                            kind::none             );
+    ASSERT_EQ( booleval::utils::any_value{ -1 }.type(),                        kind::signed_integer   );
+    ASSERT_EQ( booleval::utils::any_value{ 1U }.type(),                        kind::unsigned_integer );
+    ASSERT_EQ( booleval::utils::any_value{ 1.F }.type(),                       kind::single_precision );
+    ASSERT_EQ( booleval::utils::any_value{ 1. }.type(),                        kind::double_precision );
+    ASSERT_EQ( booleval::utils::any_value{ "abc" }.type(),                     kind::string           );
+    ASSERT_EQ( booleval::utils::any_value{ std::string_view{ "abc" } }.type(), kind::string           );
+}
+
+TEST( AnyValueTest, TypeAwareComparisons )
+{
+    using booleval::utils::constant;
+
+    {
+        // not representable as double, compared exactly as integer
+        booleval::utils::any_value value{ std::int64_t{ 9007199254740993 } };
+
+        ASSERT_TRUE ( value == constant{ "9007199254740993" } );
+        ASSERT_FALSE( value == constant{ "9007199254740992" } );
+    }
+    {
+        booleval::utils::any_value value{ 0U };
+
+        ASSERT_TRUE ( value >  constant{ "-1" } );
+        ASSERT_FALSE( value == constant{ "-1" } );
+    }
+    {
+        booleval::utils::any_value value{ 0.1F };
+
+        ASSERT_TRUE ( value == constant{ "0.1" } );
+        ASSERT_FALSE( value <  constant{ "0.1" } );
+    }
+    {
+        booleval::utils::any_value value{ 1.2345678 };
+
+        ASSERT_TRUE ( value == constant{ "1.2345678" } );
+        ASSERT_FALSE( value == constant{ "1.234568" }  );
+    }
+}
+
+TEST( AnyValueTest, CopyAndMove )
+{
+    booleval::utils::any_value value{ std::string( 64, 'a' ) };
+
+    booleval::utils::any_value copy{ value };
+    ASSERT_EQ( copy, std::string( 64, 'a' ) );
+    ASSERT_EQ( copy, value                  );
+
+    booleval::utils::any_value moved{ std::move( value ) };
+    ASSERT_EQ( moved, std::string( 64, 'a' ) );
+
+    copy = booleval::utils::any_value{ 1 };
+    ASSERT_EQ( copy, "1" );
+
+    copy = moved;
+    ASSERT_EQ( copy, moved );
+}
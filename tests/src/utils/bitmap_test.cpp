@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <vector>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <booleval/utils/bitmap.hpp>
+
+TEST( BitmapTest, Empty )
+{
+    booleval::utils::bitmap bitmap;
+
+    ASSERT_EQ( bitmap.size (), 0u );
+    ASSERT_EQ( bitmap.words(), 0u );
+    ASSERT_EQ( bitmap.count(), 0u );
+}
+
+TEST( BitmapTest, SetAndTest )
+{
+    booleval::utils::bitmap bitmap{ 130u };
+
+    ASSERT_EQ( bitmap.size (), 130u );
+    ASSERT_EQ( bitmap.words(), 3u   );
+
+    bitmap.set( 0u   );
+    bitmap.set( 63u  );
+    bitmap.set( 64u  );
+    bitmap.set( 129u );
+
+    ASSERT_TRUE ( bitmap.test( 0u   ) );
+    ASSERT_FALSE( bitmap.test( 1u   ) );
+    ASSERT_TRUE ( bitmap.test( 63u  ) );
+    ASSERT_TRUE ( bitmap.test( 64u  ) );
+    ASSERT_TRUE ( bitmap.test( 129u ) );
+    ASSERT_EQ   ( bitmap.count(), 4u  );
+    ASSERT_EQ   ( bitmap.data()[ 1 ], 1u );
+
+    std::vector< std::uint32_t > indices;
+    bitmap.indices( indices );
+
+    ASSERT_EQ( indices, ( std::vector< std::uint32_t >{ 0u, 63u, 64u, 129u } ) );
+
+    bitmap.reset( 10u );
+
+    ASSERT_EQ( bitmap.size (), 10u );
+    ASSERT_EQ( bitmap.count(), 0u  );
+}
+
+TEST( BitmapTest, LowestBit )
+{
+    ASSERT_EQ( booleval::utils::lowest_bit( 1u                      ), 0u  );
+    ASSERT_EQ( booleval::utils::lowest_bit( 0b1000u                 ), 3u  );
+    ASSERT_EQ( booleval::utils::lowest_bit( std::uint64_t{ 1u } << 63 ), 63u );
+    ASSERT_EQ( booleval::utils::popcount  ( ~std::uint64_t{ 0u }    ), 64u );
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <gtest/gtest.h>
+
+#include <booleval/utils/char_class.hpp>
+#include <booleval/utils/instruction_set.hpp>
+
+namespace
+{
+
+    constexpr std::array instruction_sets
+    {
+        booleval::utils::instruction_set::scalar,
+        booleval::utils::instruction_set::sse42,
+        booleval::utils::instruction_set::avx2
+    };
+
+    booleval::utils::char_class make( std::string_view const chars )
+    {
+        booleval::utils::char_class set{};
+        for ( auto const c : chars )
+        {
+            EXPECT_TRUE( set.insert( c ) );
+        }
+        return set;
+    }
+
+} // namespace
+
+TEST( CharClassTest, Contains )
+{
+    constexpr std::string_view chars{ " \"(),\x80\xFF" };
+
+    auto const set{ make( chars ) };
+
+    for ( int i{ 0 }; i < 256; ++i )
+    {
+        auto const c{ static_cast< char >( i ) };
+        ASSERT_EQ( set.contains( c ), chars.find( c ) != std::string_view::npos ) << i;
+    }
+}
+
+TEST( CharClassTest, TooManyHighNibbles )
+{
+    booleval::utils::char_class set{};
+
+    for ( auto const c : std::string_view{ "\x01!1AQaq\x80" } )
+    {
+        ASSERT_TRUE( set.insert( c ) );
+    }
+
+    // characters sharing the high nibble with the existing ones are still fine
+    ASSERT_TRUE ( set.insert( 'b'    ) );
+    ASSERT_FALSE( set.insert( '\x90' ) );
+}
+
+TEST( CharClassTest, Find )
+{
+    auto const set{ make( " (),\"" ) };
+
+    // single character of the set at every position of the ranges of all the lengths up to 100 characters
+    for ( auto const isa : instruction_sets )
+    {
+        if ( isa > booleval::utils::supported_instruction_set() ) { continue; }
+
+        for ( std::size_t size{ 0u }; size <= 100u; ++size )
+        {
+            std::string text( size, 'a' );
+            auto const first{ std::data( text ) };
+            auto const last { first + size     };
+
+            ASSERT_EQ( booleval::utils::find( isa, first, last, set ), last );
+
+            for ( std::size_t position{ 0u }; position < size; ++position )
+            {
+                text[ position ] = position % 2u == 0u ? ',' : '\"';
+
+                ASSERT_EQ( booleval::utils::find( isa, first, last, set ), first + position );
+
+                text[ position ] = position % 3u == 0u ? '\xA0' : '0';
+            }
+        }
+    }
+}
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <booleval/utils/constant_set.hpp>
+
+namespace
+{
+
+    booleval::utils::constant_set make_set( std::vector< std::string > const & values )
+    {
+        std::vector< booleval::utils::constant > constants;
+        for ( auto const & value : values )
+        {
+            constants.emplace_back( value );
+        }
+
+        return { std::cbegin( constants ), std::cend( constants ) };
+    }
+
+} // namespace
+
+TEST( ConstantSetTest, Empty )
+{
+    booleval::utils::constant_set set;
+
+    ASSERT_TRUE ( set.empty()                                          );
+    ASSERT_FALSE( set.contains( booleval::utils::any_value{ "foo" } ) );
+}
+
+TEST( ConstantSetTest, SmallSet )
+{
+    std::vector< std::string > const values{ "foo", "1", "2.5" };
+    auto const set{ make_set( values ) };
+
+    ASSERT_EQ   ( set.size(), 3u                                        );
+    ASSERT_TRUE ( set.contains( booleval::utils::any_value{ "foo" } )  );
+    ASSERT_TRUE ( set.contains( booleval::utils::any_value{ "1" } )    );
+    ASSERT_TRUE ( set.contains( booleval::utils::any_value{ 1 } )      );
+    ASSERT_TRUE ( set.contains( booleval::utils::any_value{ 2.5F } )   );
+    ASSERT_FALSE( set.contains( booleval::utils::any_value{ "bar" } )  );
+    ASSERT_FALSE( set.contains( booleval::utils::any_value{ 2 } )      );
+    ASSERT_FALSE( set.contains( booleval::utils::any_value{} )         );
+}
+
+TEST( ConstantSetTest, LargeSet )
+{
+    std::vector< std::string > values;
+    for ( auto i{ 0 }; i < 10000; ++i )
+    {
+        values.push_back( "value" + std::to_string( i ) );
+        values.push_back( std::to_string( i * 2 ) );
+    }
+    values.push_back( "0.1" );
+
+    auto const set{ make_set( values ) };
+    ASSERT_EQ( set.size(), 20001u );
+
+    for ( auto i{ 0 }; i < 10000; ++i )
+    {
+        ASSERT_TRUE ( set.contains( booleval::utils::any_value{ "value" + std::to_string( i ) } ) );
+        ASSERT_TRUE ( set.contains( booleval::utils::any_value{ i * 2 } )                          );
+        ASSERT_FALSE( set.contains( booleval::utils::any_value{ i * 2 + 1 } )                      );
+    }
+
+    // numeric values are found regardless of their type
+    ASSERT_TRUE ( set.contains( booleval::utils::any_value{ 42U  } ) );
+    ASSERT_TRUE ( set.contains( booleval::utils::any_value{ 42.  } ) );
+    ASSERT_TRUE ( set.contains( booleval::utils::any_value{ 0.1F } ) );
+    ASSERT_TRUE ( set.contains( booleval::utils::any_value{ "42" } ) );
+
+    ASSERT_FALSE( set.contains( booleval::utils::any_value{ "value10000" } ) );
+    ASSERT_FALSE( set.contains( booleval::utils::any_value{ -2 }           ) );
+    ASSERT_FALSE( set.contains( booleval::utils::any_value{ "042" }        ) );
+}
+
+TEST( ConstantSetTest, LargeIntegerSet )
+{
+    constexpr std::int64_t base{ 1000000000000 };
+
+    std::vector< std::string > values;
+    for ( std::int64_t i{ 0 }; i < 10000; ++i )
+    {
+        values.push_back( std::to_string( base + i * 2 ) );
+    }
+
+    auto const set{ make_set( values ) };
+    ASSERT_EQ( set.size(), 10000u );
+
+    std::size_t probes{ 0u };
+    for ( std::int64_t i{ 0 }; i < 10000; ++i )
+    {
+        booleval::utils::any_value const hit { base + i * 2     };
+        booleval::utils::any_value const miss{ base + i * 2 + 1 };
+
+        ASSERT_TRUE ( set.contains( hit  ) );
+        ASSERT_FALSE( set.contains( miss ) );
+
+        probes += set.probes( hit ) + set.probes( miss );
+    }
+
+    // integers are hashed exactly, so the probe sequences stay short
+    ASSERT_LT( probes, 4u * 2u * 10000u );
+
+    ASSERT_TRUE ( set.contains( booleval::utils::any_value{ static_cast< std::uint64_t >( base ) } ) );
+    ASSERT_TRUE ( set.contains( booleval::utils::any_value{ static_cast< double >( base ) } )        );
+    ASSERT_FALSE( set.contains( booleval::utils::any_value{ static_cast< double >( base ) + 1. } )   );
+    ASSERT_FALSE( set.contains( booleval::utils::any_value{ -base } )                                );
+
+    // floats are still compared with float precision
+    ASSERT_TRUE ( set.contains( booleval::utils::any_value{ static_cast< float >( base + 1 ) } ) );
+}
+
+TEST( ConstantSetTest, Excludes )
+{
+    std::vector< std::string > const numbers{ "1", "2.5" };
+    std::vector< std::string > const mixed  { "foo", "1" };
+
+    auto const numeric{ make_set( numbers ) };
+    auto const other  { make_set( mixed   ) };
+
+    ASSERT_TRUE ( numeric.excludes( booleval::utils::any_value{ 2 } )     );
+    ASSERT_TRUE ( numeric.excludes( booleval::utils::any_value{ "foo" } ) );
+    ASSERT_FALSE( numeric.excludes( booleval::utils::any_value{ 1 } )     );
+    ASSERT_FALSE( numeric.excludes( booleval::utils::any_value{} )        );
+
+    // numeric values are not comparable to 'foo', so they are not different from it either
+    ASSERT_TRUE ( other.excludes( booleval::utils::any_value{ "bar" } ) );
+    ASSERT_FALSE( other.excludes( booleval::utils::any_value{ "foo" } ) );
+    ASSERT_FALSE( other.excludes( booleval::utils::any_value{ 2 } )     );
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026, Marin Peko
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above
+ *   copyright notice, this list of conditions and the following disclaimer
+ *   in the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <string_view>
+#include <gtest/gtest.h>
+#include <booleval/utils/constant.hpp>
+
+TEST( ConstantTest, DefaultConstructor )
+{
+    booleval::utils::constant constant;
+
+    ASSERT_EQ   ( constant.type(), booleval::utils::constant::kind::string );
+    ASSERT_FALSE( constant.numeric()                                       );
+    ASSERT_TRUE ( constant.text().empty()                                  );
+}
+
+TEST( ConstantTest, Integer )
+{
+    booleval::utils::constant constant{ "-42" };
+
+    ASSERT_EQ  ( constant.type(), booleval::utils::constant::kind::integer );
+    ASSERT_TRUE( constant.numeric()                                        );
+    ASSERT_EQ  ( constant.integer(), -42                                   );
+    ASSERT_EQ  ( constant.number(), -42.                                   );
+    ASSERT_EQ  ( constant.length(), 3u                                     );
+}
+
+TEST( ConstantTest, FloatingPoint )
+{
+    {
+        booleval::utils::constant constant{ "1.5" };
+
+        ASSERT_EQ( constant.type(), booleval::utils::constant::kind::floating_point );
+        ASSERT_EQ( constant.number(), 1.5                                           );
+    }
+    {
+        booleval::utils::constant constant{ "1U" };
+
+        ASSERT_EQ( constant.type(), booleval::utils::constant::kind::floating_point );
+        ASSERT_EQ( constant.number(), 1.                                            );
+    }
+}
+
+TEST( ConstantTest, String )
+{
+    booleval::utils::constant constant{ "foo" };
+
+    ASSERT_EQ   ( constant.type(), booleval::utils::constant::kind::string         );
+    ASSERT_FALSE( constant.numeric()                                               );
+    ASSERT_EQ   ( constant.text(), "foo"                                           );
+    ASSERT_EQ   ( constant.length(), 3u                                            );
+    ASSERT_EQ   ( constant.hash(), std::hash< std::string_view >{}( "foo" )        );
+}
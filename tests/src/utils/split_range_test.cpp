@@ -27,6 +27,8 @@
  *
  */
 
+#include <string>
+#include <string_view>
 #include <gtest/gtest.h>
 #include <booleval/utils/split_range.hpp>
 
@@ -183,4 +185,62 @@ TEST( SplitRangeTest, SplitWithMultipleOptionsAndParentheses )
     test_split_range_iterator( it++, true , "a b c" );
     test_split_range_iterator( it++, false, ")"     );
     ASSERT_EQ( it, end );
-}
\ No newline at end of file
+}
+
+TEST( SplitRangeTest, SplitVectorized )
+{
+    constexpr auto options
+    {
+        booleval::utils::split_options::include_delimiters  |
+        booleval::utils::split_options::split_by_whitespace |
+        booleval::utils::split_options::allow_quoted_strings
+    };
+
+    // tokens of all the lengths around the 16 and 32 characters processed at a time, including non-ASCII ones
+    std::string expression;
+    for ( std::size_t length{ 1u }; length < 70u; ++length )
+    {
+        expression += "(" + std::string( length, length % 3u == 0u ? '\xE9' : 'a' ) + " , ";
+        expression += "\"" + std::string( length, 'q' ) + " \" \"" + std::string( length, '(' ) + "\") ";
+    }
+
+    for ( std::size_t first{ 0u }; first < std::size( expression ); first += 7u )
+    {
+        std::string_view const strv{ std::data( expression ) + first, std::size( expression ) - first };
+
+        auto const expected{ booleval::utils::split_range< options                                             >( strv, "()," ) };
+        auto const actual  { booleval::utils::split_range< options | booleval::utils::split_options::vectorized >( strv, "()," ) };
+
+        auto expected_it{ std::begin( expected ) };
+        auto actual_it  { std::begin( actual   ) };
+
+        for ( ; expected_it != std::end( expected ); ++expected_it, ++actual_it )
+        {
+            ASSERT_NE( actual_it, std::end( actual ) );
+            test_split_range_iterator( actual_it, expected_it->is_quoted, expected_it->value );
+        }
+
+        ASSERT_EQ( actual_it, std::end( actual ) );
+    }
+}
+
+TEST( SplitRangeTest, SplitVectorizedWithManyDelimiters )
+{
+    // delimiters having more than 8 distinct high nibbles are searched for one by one
+    auto const range
+    {
+        booleval::utils::split_range
+        <
+            booleval::utils::split_options::exclude_delimiters |
+            booleval::utils::split_options::vectorized
+        >( "a\x01" "b!c1dAeQfagqh\x80i\x90j", "\x01!1AQaq\x80\x90" )
+    };
+    auto       it { range.begin() };
+    auto const end{ range.end()   };
+
+    for ( auto const expected : { "a", "b", "c", "d", "e", "f", "g", "h", "i", "j" } )
+    {
+        test_split_range_iterator( it++, false, expected );
+    }
+    ASSERT_EQ( it, end );
+}